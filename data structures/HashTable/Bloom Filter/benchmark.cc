@@ -0,0 +1,68 @@
+/**
+ * A benchmark that measures the lookups of a SeparateChaining<string, int> and a LinearProbing<string, int> table
+ * of n keys (by default 2^22) with and without a FilteredTable in front of it, for workloads with 0%, 90% and 99%
+ * missing keys.
+ * A hit pays for the filter in addition to the table, so the filter only pays off if most lookups miss.
+ * Usage: ./benchmark [n]
+*/
+
+#include "../Separate Chaining/separateChaining.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+#include "filteredTable.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+// looks up 'operations' keys of which 'missPercentage' percent are missing and returns the elapsed seconds;
+// the first n keys are in the table, the others are missing
+template <typename Table>
+double run(const Table &table, const vector<string> &keys, int n, int operations, int missPercentage)
+{
+    auto start = chrono::steady_clock::now();
+
+    int hits = 0;
+    for (int i = 0; i < operations; i++)
+    {
+        bool miss = i % 100 < missPercentage;
+        hits += table.contains(miss ? keys[n + i] : keys[(i * 7919LL) % n]);
+    }
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    if (hits != operations - operations / 100 * missPercentage)
+        throw runtime_error{"Unexpected number of hits."};
+
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    const int operations = 5000000;
+
+    vector<string> keys;
+    for (long i = 0; i < n + operations; i++)
+        keys.push_back("customer-" + to_string(i * 2654435761u));
+
+    SeparateChaining<string, int> table{2};
+    FilteredTable<SeparateChaining, string, int> filtered{2};
+    LinearProbing<string, int> lpTable{2};
+    FilteredTable<LinearProbing, string, int> lpFiltered{2};
+    for (int i = 0; i < n; i++)
+    {
+        table.put(keys[i], i);
+        filtered.put(keys[i], i);
+        lpTable.put(keys[i], i);
+        lpFiltered.put(keys[i], i);
+    }
+
+    cout << "Filter: " << 8.0 * filtered.getFilter().getSizeInBytes() / n << " bits per key, false positive rate "
+         << filtered.getFilter().getFalsePositiveRate() << endl;
+
+    cout << "misses\tSeparateChaining (s)\tFiltered (s)\tLinearProbing (s)\tFiltered (s)" << endl;
+    for (int missPercentage : {0, 90, 99})
+        cout << missPercentage << "%\t" << run(table, keys, n, operations, missPercentage) << "\t"
+             << run(filtered, keys, n, operations, missPercentage) << "\t"
+             << run(lpTable, keys, n, operations, missPercentage) << "\t"
+             << run(lpFiltered, keys, n, operations, missPercentage) << endl;
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+#ifndef BLOCKED_BLOOM_FILTER_HPP
+#define BLOCKED_BLOOM_FILTER_HPP
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include "../transparentHash.hpp"
+using namespace std;
+
+/**
+ * The BlockedBloomFilter class implements a split block Bloom filter: a set of keys that answers 'mayContain'
+ * with false for a key that was never inserted, and with true for an inserted key and, with a small false
+ * positive rate, for other keys. Unlike a hash table it doesn't store the keys, so it needs only a few bits
+ * per key.
+ * The filter is an array of blocks of one cache line (512 bits = 8 words of 64 bits). A key selects one block
+ * with its hash code and sets one bit in each of the 8 words of the block. So, an insertion or a lookup touches
+ * exactly one cache line, and the 8 bits are computed independently of each other (the same operations on 8
+ * lanes, which the compiler can vectorize).
+ * The number of blocks is computed from the expected number of keys and the desired false positive rate. The
+ * rate only holds as long as no more keys are inserted than expected; keys can't be deleted, so a filter has
+ * to be rebuilt after many deletions of the underlying set (see FilteredTable).
+*/
+
+template <typename Key, typename Hash = TransparentHash<Key>>
+class BlockedBloomFilter
+{
+    // holds the number of words of a block (one bit per word is set for every key)
+    static constexpr int wordsPerBlock = 8;
+
+    // a block of one cache line
+    struct alignas(64) Block
+    {
+        uint64_t words[wordsPerBlock];
+    };
+
+    // odd constants that select the bit of each word (the salts of the Parquet split block Bloom filter)
+    static constexpr uint32_t salts[wordsPerBlock] = {0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+                                                      0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u};
+
+    // the blocks
+    vector<Block> blocks;
+
+    // holds the number of inserted keys (including repeated insertions of the same key)
+    long insertions;
+
+    // our hasher which we'll use for hashing
+    Hash hasher;
+
+    // method that computes the mixed hash code of a key (the finalizer of MurmurHash3)
+    template <typename K>
+    uint64_t hashing(const K &key) const
+    {
+        uint64_t h = hasher(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // method that selects the block of a hash code by its upper bits
+    size_t blockIndex(uint64_t h) const
+    {
+        return (static_cast<unsigned __int128>(h) * blocks.size()) >> 64;
+    }
+
+    // method that computes the bit of each word for a hash code from its lower 32 bits
+    static void maskOf(uint64_t h, uint64_t mask[wordsPerBlock])
+    {
+        uint32_t low = static_cast<uint32_t>(h);
+        for (int i = 0; i < wordsPerBlock; i++)
+            mask[i] = 1ull << ((low * salts[i]) >> 26);
+    }
+
+public:
+    // method that computes the false positive rate of a filter holding 'bitsPerKey' bits per key: the number
+    // of keys in a block follows a Poisson distribution, and for a block with i keys a word has a given bit
+    // set with the probability 1 - (1 - 1/64)^i
+    static double falsePositiveRate(double bitsPerKey)
+    {
+        double keysPerBlock = 64.0 * wordsPerBlock / bitsPerKey;
+        double rate = 0;
+
+        // the terms of the Poisson distribution are computed iteratively
+        double probability = exp(-keysPerBlock);
+        for (int i = 0; i < 10 * keysPerBlock + 100; i++)
+        {
+            rate += probability * pow(1 - pow(1 - 1.0 / 64, i), wordsPerBlock);
+            probability *= keysPerBlock / (i + 1);
+        }
+
+        return rate;
+    }
+
+    // constructor; the filter is sized for 'expectedKeys' keys with the given false positive rate
+    BlockedBloomFilter(long expectedKeys, double targetRate = 0.01, Hash hasher = Hash()) : insertions{0}, hasher{hasher}
+    {
+        // Sanity checks
+        if (expectedKeys < 0)
+            throw invalid_argument{"Invalid argument: expected keys < 0."};
+
+        if (targetRate <= 0 || targetRate >= 1)
+            throw invalid_argument{"Invalid argument: false positive rate not in (0, 1)."};
+
+        // the smallest number of bits per key (in steps of 1/4) reaching the false positive rate
+        double bitsPerKey = 1;
+        while (falsePositiveRate(bitsPerKey) > targetRate)
+            bitsPerKey += 0.25;
+
+        long nrOfBlocks = ceil(expectedKeys * bitsPerKey / (64 * wordsPerBlock));
+        blocks.assign(max(nrOfBlocks, 1L), Block{});
+    }
+
+    // used to insert a key
+    template <typename K>
+    void insert(const K &key)
+    {
+        uint64_t h = hashing(key);
+        uint64_t mask[wordsPerBlock];
+        maskOf(h, mask);
+
+        Block &block = blocks[blockIndex(h)];
+        for (int i = 0; i < wordsPerBlock; i++)
+            block.words[i] |= mask[i];
+
+        this->insertions++;
+    }
+
+    // used to check if a key may have been inserted; false means that it was certainly not inserted
+    template <typename K>
+    bool mayContain(const K &key) const
+    {
+        uint64_t h = hashing(key);
+        uint64_t mask[wordsPerBlock];
+        maskOf(h, mask);
+
+        const Block &block = blocks[blockIndex(h)];
+
+        // all 8 bits have to be set (combined without branches)
+        uint64_t missing = 0;
+        for (int i = 0; i < wordsPerBlock; i++)
+            missing |= mask[i] & ~block.words[i];
+
+        return missing == 0;
+    }
+
+    // used to remove all keys
+    void clear()
+    {
+        blocks.assign(blocks.size(), Block{});
+        this->insertions = 0;
+    }
+
+    // used to get the number of insertions since the filter was created or cleared
+    long getInsertions() const
+    {
+        return this->insertions;
+    }
+
+    // used to get the size of the filter in bytes
+    long getSizeInBytes() const
+    {
+        return blocks.size() * sizeof(Block);
+    }
+
+    // used to get the expected false positive rate for the current number of insertions
+    double getFalsePositiveRate() const
+    {
+        if (this->insertions == 0)
+            return 0;
+
+        return falsePositiveRate(8.0 * getSizeInBytes() / this->insertions);
+    }
+};
+
+#endif
\ No newline at end of file
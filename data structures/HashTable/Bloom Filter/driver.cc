@@ -0,0 +1,89 @@
+/**
+ * The client that tests the functionalities of the BlockedBloomFilter class and of the FilteredTable class
+ * in front of a SeparateChaining table and a LinearProbing table.
+*/
+
+#include "../Separate Chaining/separateChaining.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+#include "filteredTable.hpp"
+#include <string>
+
+int main()
+{
+    // the standalone filter
+    BlockedBloomFilter<string> bf{1000, 0.01};
+    bf.insert("Abdullah");
+    bf.insert("Arif");
+
+    cout << "May the filter contain Abdullah? Answer: " << boolalpha << bf.mayContain("Abdullah") << endl;
+    cout << "May the filter contain Klaus? Answer: " << bf.mayContain("Klaus") << endl;
+    cout << "Size of the filter: " << bf.getSizeInBytes() << " bytes" << endl;
+
+    // the measured false positive rate of a full filter
+    const int n = 1000000;
+    BlockedBloomFilter<int> numbers{n, 0.01};
+    for (int i = 0; i < n; i++)
+        numbers.insert(i);
+
+    int falsePositives = 0;
+    for (int i = n; i < 2 * n; i++)
+        falsePositives += numbers.mayContain(i);
+
+    cout << "False positive rate: expected " << numbers.getFalsePositiveRate() << ", measured "
+         << static_cast<double>(falsePositives) / n << endl;
+
+    // the filter in front of a table
+    FilteredTable<SeparateChaining, string, int> ft{2};
+    ft.put("Abdullah", 33);
+    ft.put("Abdullah", 36);
+    ft.put("Arif", 28);
+    ft.put("Günther", 55);
+
+    cout << "The value of key Abdullah is " << ft.getValue("Abdullah") << endl;
+    cout << "Does the key Klaus exist? Answer: " << ft.contains("Klaus") << endl;
+
+    ft.removal("Abdullah");
+    cout << "Does the key Abdullah exist? Answer: " << ft.contains("Abdullah") << endl;
+    cout << "How many elements do we have? Answer: " << ft.getElements() << endl;
+
+    // after removing most of the keys, the filter is rebuilt from the remaining keys
+    FilteredTable<SeparateChaining, int, int> large{2};
+    for (int i = 0; i < n; i++)
+        large.put(i, i);
+
+    for (int i = 0; i < n - 1000; i++)
+        large.removal(i);
+
+    cout << "Insertions in the filter after removing " << n - 1000 << " of " << n << " keys: "
+         << large.getFilter().getInsertions() << endl;
+
+    // the filter in front of a LinearProbing table
+    FilteredTable<LinearProbing, string, int> lp{2};
+    lp.put("Tim", 18);
+    lp.put("Torben", 22);
+    lp.put("Tim", 19);
+
+    cout << "The value of key Tim is " << lp.getValue("Tim") << endl;
+    cout << "Does the key Klaus exist? Answer: " << lp.contains("Klaus") << endl;
+
+    // LinearProbing ignores a missing key, and so does the filtered table
+    lp.removal("Klaus");
+    lp.removal("Tim");
+    cout << "Does the key Tim exist? Answer: " << lp.contains("Tim") << endl;
+    cout << "How many elements do we have? Answer: " << lp.getElements() << endl;
+
+    // the filter is rebuilt when it is full and after removing most of the keys
+    FilteredTable<LinearProbing, int, int> lpLarge{2};
+    for (int i = 0; i < n; i++)
+        lpLarge.put(i, i);
+
+    for (int i = 0; i < n - 1000; i++)
+        lpLarge.removal(i);
+
+    bool allFound = true;
+    for (int i = n - 1000; i < n; i++)
+        allFound &= lpLarge.contains(i) && lpLarge.getValue(i) == i;
+
+    cout << "Insertions in the filter after removing " << n - 1000 << " of " << n << " keys: "
+         << lpLarge.getFilter().getInsertions() << ", are the remaining keys found? Answer: " << allFound << endl;
+}
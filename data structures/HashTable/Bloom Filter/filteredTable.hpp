@@ -0,0 +1,163 @@
+#ifndef FILTERED_TABLE_HPP
+#define FILTERED_TABLE_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include "blockedBloomFilter.hpp"
+
+/**
+ * The FilteredTable class puts a BlockedBloomFilter in front of a hash table (LinearProbing or SeparateChaining,
+ * e.g. FilteredTable<SeparateChaining, string, int>). Every key put into the table is inserted into the filter,
+ * so 'contains', 'find' and 'getValue' return right away for most of the missing keys: the filter touches one
+ * cache line, whereas the table would walk a list or a cluster in cold memory.
+ * The filter is sized for twice the number of pairs and rebuilt from the keys of the table when it is full;
+ * since it can't delete keys, it is also rebuilt when more pairs have been removed than are left in the table
+ * (the bits of the removed keys would raise the false positive rate), or when 'rebuild' is called.
+ * Include the header of the table before this header.
+*/
+
+template <template <typename, typename, typename> class Table, typename Key, typename Value, typename Hash = TransparentHash<Key>>
+class FilteredTable
+{
+    // the smallest number of keys the filter is sized for
+    static constexpr long minCapacity = 64;
+
+    // the hash table
+    Table<Key, Value, Hash> table;
+
+    // the filter holding the keys of the table (and of the pairs removed since it was built)
+    BlockedBloomFilter<Key, Hash> filter;
+
+    // the false positive rate of the filter
+    double falsePositiveRate;
+
+    // holds the number of key-value pairs
+    long elements;
+
+    // holds the number of key-value pairs removed since the filter was built
+    long removed;
+
+    // holds the number of keys the filter is sized for
+    long capacity;
+
+    // our hasher which we'll use for hashing
+    Hash hasher;
+
+public:
+    // constructor; 'size' is the initial size of the table
+    FilteredTable(int size, double falsePositiveRate = 0.01, Hash hasher = Hash())
+        : table{size, hasher}, filter{max<long>(size, minCapacity), falsePositiveRate, hasher},
+          falsePositiveRate{falsePositiveRate}, elements{0}, removed{0}, capacity{max<long>(size, minCapacity)}, hasher{hasher}
+    {
+    }
+
+    // used to get the number of key-value pairs
+    long getElements() const
+    {
+        return this->elements;
+    }
+
+    // check if the table is empty
+    bool isEmpty() const
+    {
+        return this->elements == 0;
+    }
+
+    // used to get the hash table (read-only, since a modification has to update the filter)
+    const Table<Key, Value, Hash> &getTable() const
+    {
+        return table;
+    }
+
+    // used to get the filter
+    const BlockedBloomFilter<Key, Hash> &getFilter() const
+    {
+        return filter;
+    }
+
+    // used to rebuild the filter from the keys of the table; the new filter is sized for twice the number of
+    // key-value pairs
+    void rebuild()
+    {
+        capacity = max(2 * this->elements, minCapacity);
+        filter = BlockedBloomFilter<Key, Hash>{capacity, falsePositiveRate, hasher};
+
+        table.forEach([this](const Key &key, const Value &) { filter.insert(key); });
+        removed = 0;
+    }
+
+    // used to check if the table contains a given key
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        return filter.mayContain(key) && table.contains(key);
+    }
+
+    // used to get a pointer to the value of a given key, or nullptr if the key does not exist
+    template <typename K>
+    Value *find(const K &key)
+    {
+        return filter.mayContain(key) ? table.find(key) : nullptr;
+    }
+
+    template <typename K>
+    const Value *find(const K &key) const
+    {
+        return filter.mayContain(key) ? table.find(key) : nullptr;
+    }
+
+    // used to get the value of a given key
+    template <typename K>
+    Value getValue(const K &key) const
+    {
+        // if the filter rules the key out, an exception is thrown without searching the table
+        if (!filter.mayContain(key))
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return table.getValue(key);
+    }
+
+    // puts a key-value pair into the table
+    void put(Key key, Value value)
+    {
+        filter.insert(key);
+
+        auto [slot, inserted] = table.tryEmplace(move(key), move(value));
+
+        // if key already in the table, update its value
+        // (the value is only moved by 'tryEmplace' if the key was inserted)
+        if (!inserted)
+        {
+            *slot = move(value);
+            return;
+        }
+
+        this->elements++;
+
+        // the filter is full
+        if (filter.getInsertions() > capacity)
+            rebuild();
+    }
+
+    // used to delete a key-value pair; a missing key is handled like the table does it
+    // the table is only searched once: whether the key was removed is told by the number of pairs of the table
+    template <typename K>
+    void removal(const K &key)
+    {
+        long before = table.getElements();
+        table.removal(key);
+
+        if (table.getElements() == before)
+            return;
+
+        this->elements--;
+        this->removed++;
+
+        // most of the keys in the filter have been removed
+        if (this->removed > max(this->elements, minCapacity))
+            rebuild();
+    }
+};
+
+#endif
\ No newline at end of file
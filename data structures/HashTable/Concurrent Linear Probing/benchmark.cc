@@ -0,0 +1,88 @@
+/**
+ * A benchmark that measures the lookup throughput of the ConcurrentLinearProbing class and of the sharded
+ * ConcurrentMap class while one writer thread replaces, deletes and inserts keys at a few thousand operations
+ * per second. The number of reader threads goes from 1 to 16.
+ * Compile with -pthread.
+*/
+
+#include "concurrentLinearProbing.hpp"
+#include "../Concurrent/concurrentMap.hpp"
+#include <chrono>
+
+// runs the readers and the writer for 'seconds' and returns the million lookups per second
+template <typename Map>
+double run(Map &map, int keys, int readers, double seconds)
+{
+    for (int i = 0; i < keys; i++)
+        map.put(i, i);
+
+    atomic<bool> stop{false};
+    atomic<long> lookups{0};
+
+    // the writer: about 5000 operations per second
+    thread writer([&map, &stop, keys]() {
+        for (int i = 0; !stop.load(); i++)
+        {
+            int key = (i * 7919LL) % keys;
+            if (i % 4 == 0)
+            {
+                map.removal(key);
+                map.put(key, i);
+            }
+            else
+                map.put(key, i);
+
+            this_thread::sleep_for(chrono::microseconds(200));
+        }
+    });
+
+    vector<thread> workers;
+    for (int t = 0; t < readers; t++)
+    {
+        workers.emplace_back([&map, &stop, &lookups, keys, t]() {
+            unsigned int state = t + 1;
+            long count = 0;
+            int value;
+
+            while (!stop.load(memory_order_relaxed))
+            {
+                for (int i = 0; i < 1000; i++)
+                {
+                    state = state * 1103515245 + 12345;
+                    map.tryGetValue(static_cast<int>((state >> 8) % keys), value);
+                }
+                count += 1000;
+            }
+
+            lookups.fetch_add(count);
+        });
+    }
+
+    this_thread::sleep_for(chrono::duration<double>(seconds));
+    stop.store(true);
+
+    for (auto &worker : workers)
+        worker.join();
+    writer.join();
+
+    return lookups.load() / seconds / 1e6;
+}
+
+int main()
+{
+    const int keys = 100000;
+    const double seconds = 1.0;
+
+    cout << "readers\tConcurrentMap (Mlookups/s)\tConcurrentLinearProbing (Mlookups/s)" << endl;
+
+    for (int readers = 1; readers <= 16; readers *= 2)
+    {
+        ConcurrentMap<int, int> sharded{64};
+        ConcurrentLinearProbing<int, int> lockFree;
+
+        double shardedThroughput = run(sharded, keys, readers, seconds);
+        double lockFreeThroughput = run(lockFree, keys, readers, seconds);
+
+        cout << readers << "\t" << shardedThroughput << "\t\t\t\t" << lockFreeThroughput << endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,408 @@
+#ifndef CONCURRENT_LINEAR_PROBING_HPP
+#define CONCURRENT_LINEAR_PROBING_HPP
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "../transparentHash.hpp"
+using namespace std;
+
+/**
+ * A concurrent variant of the LinearProbing class for read-mostly tables: lookups are wait-free and never
+ * take a lock, so any number of threads can read while one thread at a time modifies the table.
+ * Every slot holds an atomic pointer to an immutable entry (a key-value pair). A writer never changes an entry
+ * in place; it publishes a new entry with an atomic exchange of the slot pointer. A deleted key leaves a tombstone
+ * in its slot, so the clusters (and with them the probe sequences of concurrent lookups) stay intact; an insertion
+ * reuses the first tombstone of its probe sequence. When the used slots (entries and tombstones) reach one half of
+ * the table, the writer builds a new table with the live entries and publishes it with one atomic store; the
+ * entries themselves are not copied.
+ * Writers are serialized by a mutex. A lookup visits at most all slots of the table it loaded, so it finishes in a
+ * bounded number of steps no matter what the writers do.
+ * Replaced entries and old tables can't be freed right away, because a concurrent lookup might still read them.
+ * They are reclaimed with an epoch scheme: a lookup increments one of two reader counters (selected by the parity
+ * of a global epoch) on entry and decrements it on exit. To reclaim, the writer advances the epoch twice and each
+ * time waits until the counters of the previous parity drop to zero; afterwards, no lookup that could have seen
+ * the retired objects is still running. The counters are striped over cache lines, so readers of different
+ * threads don't contend on the same counter.
+*/
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
+class ConcurrentLinearProbing
+{
+    // an immutable key-value pair
+    struct Entry
+    {
+        const Key key;
+        const Value value;
+    };
+
+    // a table of atomic slots; a slot holds nullptr (unoccupied), a tombstone or an entry
+    struct Table
+    {
+        int size;
+        unique_ptr<atomic<Entry *>[]> slots;
+
+        Table(int size) : size{size}, slots{new atomic<Entry *>[size]}
+        {
+            for (int i = 0; i < size; i++)
+                slots[i].store(nullptr, memory_order_relaxed);
+        }
+    };
+
+    // the reader counters of a stripe, one per epoch parity, aligned to a cache line to avoid false sharing
+    struct alignas(64) ReaderCounter
+    {
+        atomic<long> active[2];
+    };
+
+    // holds the number of reader counter stripes
+    static constexpr int stripes = 64;
+
+    // the number of retired entries that triggers their reclamation
+    static constexpr int reclamationThreshold = 1024;
+
+    // the current table
+    atomic<Table *> table;
+
+    // holds the number of key-value pairs
+    atomic<long> elements;
+
+    // holds the number of used slots (entries and tombstones) of the current table; only used by writers
+    int usedSlots;
+
+    // serializes the writers
+    mutex writerLock;
+
+    // the epoch whose parity selects the reader counter of a new lookup
+    atomic<unsigned int> epoch;
+
+    // the reader counters
+    unique_ptr<ReaderCounter[]> readerCounters;
+
+    // the entries and tables which are no longer reachable but might still be read by a lookup
+    vector<Entry *> retiredEntries;
+    vector<Table *> retiredTables;
+
+    // our hasher which we'll use for hashing
+    Hash hasher;
+
+    // method that returns the tombstone marker
+    static Entry *tombstone()
+    {
+        static char marker;
+        return reinterpret_cast<Entry *>(&marker);
+    }
+
+    // method that returns the reader counter stripe of the calling thread
+    static int readerStripe()
+    {
+        static atomic<int> nextStripe{0};
+        static thread_local int stripe = nextStripe.fetch_add(1, memory_order_relaxed) % stripes;
+
+        return stripe;
+    }
+
+    // used to apply fibonacci hashing for a table with 'tableSize' slots
+    template <typename K>
+    int hashing(const K &key, int tableSize) const
+    {
+        return (static_cast<unsigned long long>(hasher(key)) * 11400714819323198485ull) >> (64 - __builtin_ctz(tableSize));
+    }
+
+    // method that waits until no lookup which started before the call is running anymore (a grace period)
+    void synchronize()
+    {
+        for (int round = 0; round < 2; round++)
+        {
+            // new lookups use the other parity, so the counters of the old parity can only drop
+            unsigned int oldEpoch = epoch.fetch_add(1);
+
+            for (int i = 0; i < stripes; i++)
+                while (readerCounters[i].active[oldEpoch & 1].load() != 0)
+                    this_thread::yield();
+        }
+    }
+
+    // method that frees the retired entries and tables after a grace period
+    void reclaim()
+    {
+        if (retiredEntries.empty() && retiredTables.empty())
+            return;
+
+        synchronize();
+
+        for (Entry *entry : retiredEntries)
+            delete entry;
+
+        for (Table *oldTable : retiredTables)
+            delete oldTable;
+
+        retiredEntries.clear();
+        retiredTables.clear();
+    }
+
+    // method to retire an entry which is no longer reachable
+    void retire(Entry *entry)
+    {
+        retiredEntries.push_back(entry);
+
+        if (static_cast<int>(retiredEntries.size()) >= reclamationThreshold)
+            reclaim();
+    }
+
+    // method that publishes a new table of 'newSize' slots with the live entries of the current one
+    void rebuild(int newSize)
+    {
+        Table *oldTable = table.load();
+        Table *newTable = new Table{newSize};
+
+        // the new table is not visible yet, so relaxed stores are fine
+        for (int i = 0; i < oldTable->size; i++)
+        {
+            Entry *entry = oldTable->slots[i].load(memory_order_relaxed);
+            if (entry == nullptr || entry == tombstone())
+                continue;
+
+            int j = hashing(entry->key, newSize);
+            while (newTable->slots[j].load(memory_order_relaxed) != nullptr)
+                j = (j + 1) & (newSize - 1);
+
+            newTable->slots[j].store(entry, memory_order_relaxed);
+        }
+
+        table.store(newTable);
+        usedSlots = elements.load(memory_order_relaxed);
+
+        retiredTables.push_back(oldTable);
+        reclaim();
+    }
+
+    // method that returns the size of a table holding 'n' entries at a load factor of at most one quarter
+    static int sizeFor(long n)
+    {
+        int newSize = 2;
+        while (newSize < 4 * n)
+            newSize *= 2;
+
+        return newSize;
+    }
+
+public:
+    // constructor
+    ConcurrentLinearProbing(int size = 2, Hash hasher = Hash())
+        : elements{0}, usedSlots{0}, epoch{0}, readerCounters{new ReaderCounter[stripes]}, hasher{hasher}
+    {
+        // set the size of the table to the next power of two
+        int tableSize = 2;
+        while (tableSize < size)
+            tableSize *= 2;
+
+        table.store(new Table{tableSize});
+
+        for (int i = 0; i < stripes; i++)
+        {
+            readerCounters[i].active[0].store(0);
+            readerCounters[i].active[1].store(0);
+        }
+    }
+
+    // the entries are owned by the table, so it can't be copied
+    ConcurrentLinearProbing(const ConcurrentLinearProbing &) = delete;
+    ConcurrentLinearProbing &operator=(const ConcurrentLinearProbing &) = delete;
+
+    // destructor; no other thread may use the table anymore
+    ~ConcurrentLinearProbing()
+    {
+        Table *currentTable = table.load();
+        for (int i = 0; i < currentTable->size; i++)
+        {
+            Entry *entry = currentTable->slots[i].load();
+            if (entry != nullptr && entry != tombstone())
+                delete entry;
+        }
+
+        delete currentTable;
+
+        for (Entry *entry : retiredEntries)
+            delete entry;
+
+        for (Table *oldTable : retiredTables)
+            delete oldTable;
+    }
+
+    // used to get the number of key-value pairs; only approximate while a writer modifies the table
+    long getElements() const
+    {
+        return elements.load(memory_order_relaxed);
+    }
+
+    // used to get the size of the current table
+    int getSize() const
+    {
+        return table.load()->size;
+    }
+
+    // check if the table is (approximately) empty
+    bool isEmpty() const
+    {
+        return getElements() == 0;
+    }
+
+    // used to copy the value of a given key into 'value'; returns false if the key does not exist
+    // the lookup is wait-free: it never takes a lock and never waits for a writer
+    template <typename K>
+    bool tryGetValue(const K &key, Value &value) const
+    {
+        // announce the lookup in the reader counter of the current epoch parity
+        atomic<long> &active = readerCounters[readerStripe()].active[epoch.load() & 1];
+        active.fetch_add(1);
+
+        const Table *currentTable = table.load();
+        bool found = false;
+
+        // scan through the cluster starting at the hash code of the key; tombstones don't end the cluster and
+        // the table always has an unoccupied slot
+        for (int i = hashing(key, currentTable->size);; i = (i + 1) & (currentTable->size - 1))
+        {
+            Entry *entry = currentTable->slots[i].load();
+
+            if (entry == nullptr)
+                break;
+
+            if (entry != tombstone() && entry->key == key)
+            {
+                value = entry->value;
+                found = true;
+                break;
+            }
+        }
+
+        active.fetch_sub(1);
+
+        return found;
+    }
+
+    // used to check if the table contains a given key
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        Value value;
+        return tryGetValue(key, value);
+    }
+
+    // used to get the value of a given key
+    template <typename K>
+    Value getValue(const K &key) const
+    {
+        Value value;
+
+        // if key-value pair is not in the table, an exception is thrown
+        if (!tryGetValue(key, value))
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return value;
+    }
+
+    // puts a key-value pair into the table; an existing value is replaced by a new entry
+    void put(Key key, Value value)
+    {
+        lock_guard<mutex> guard{writerLock};
+
+        Table *currentTable = table.load();
+        int mask = currentTable->size - 1;
+
+        // holds the index of the first tombstone in the probe sequence, or -1
+        int tombstoneIndex = -1;
+
+        int i = hashing(key, currentTable->size);
+        for (Entry *entry; (entry = currentTable->slots[i].load(memory_order_relaxed)) != nullptr; i = (i + 1) & mask)
+        {
+            if (entry == tombstone())
+            {
+                if (tombstoneIndex == -1)
+                    tombstoneIndex = i;
+            }
+
+            // if key already in the table, publish a new entry in its slot
+            else if (entry->key == key)
+            {
+                retire(currentTable->slots[i].exchange(new Entry{move(key), move(value)}));
+                return;
+            }
+        }
+
+        // store the new entry in the first tombstone or in the unoccupied slot
+        if (tombstoneIndex != -1)
+            i = tombstoneIndex;
+        else
+            usedSlots++;
+
+        currentTable->slots[i].store(new Entry{move(key), move(value)});
+        elements.fetch_add(1, memory_order_relaxed);
+
+        // guarantees that at most one-half of the slots are used
+        if (usedSlots >= currentTable->size / 2)
+            rebuild(sizeFor(elements.load(memory_order_relaxed)));
+    }
+
+    // used to delete a key-value pair; returns false if the key does not exist
+    template <typename K>
+    bool removal(const K &key)
+    {
+        lock_guard<mutex> guard{writerLock};
+
+        Table *currentTable = table.load();
+        int mask = currentTable->size - 1;
+
+        for (int i = hashing(key, currentTable->size);; i = (i + 1) & mask)
+        {
+            Entry *entry = currentTable->slots[i].load(memory_order_relaxed);
+
+            if (entry == nullptr)
+                return false;
+
+            if (entry != tombstone() && entry->key == key)
+            {
+                // replace the entry with a tombstone
+                retire(currentTable->slots[i].exchange(tombstone()));
+                elements.fetch_sub(1, memory_order_relaxed);
+                break;
+            }
+        }
+
+        // guarantees that the table is at least one-eighth full
+        long n = elements.load(memory_order_relaxed);
+        if (n > 0 && n <= currentTable->size / 8)
+            rebuild(sizeFor(n));
+
+        return true;
+    }
+
+    // used to print the table content (only for debugging purposes; no writer may run concurrently)
+    void printHashTable()
+    {
+        Table *currentTable = table.load();
+
+        for (int i = 0; i < currentTable->size; i++)
+        {
+            Entry *entry = currentTable->slots[i].load();
+
+            cout << "Index " << i << ": ";
+            if (entry == nullptr)
+                cout << "unoccupied" << endl;
+
+            else if (entry == tombstone())
+                cout << "deleted" << endl;
+
+            else
+                cout << "(" << entry->key << "," << entry->value << ")" << endl;
+        }
+    }
+};
+
+#endif
\ No newline at end of file
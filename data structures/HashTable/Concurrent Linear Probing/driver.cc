@@ -0,0 +1,53 @@
+/**
+ * The client that tests the functionalities of the ConcurrentLinearProbing class.
+ * Compile with -pthread.
+*/
+
+#include "concurrentLinearProbing.hpp"
+#include <string>
+
+int main()
+{
+    ConcurrentLinearProbing<string, int> routes{8};
+    routes.put("alpha", 1);
+    routes.put("beta", 2);
+    routes.put("gamma", 3);
+
+    cout << "The value of key beta is " << routes.getValue("beta") << endl;
+
+    // readers look up the keys while a writer updates them
+    atomic<bool> stop{false};
+    atomic<long> lookups{0};
+    vector<thread> readers;
+    for (int t = 0; t < 4; t++)
+        readers.emplace_back([&routes, &stop, &lookups]() {
+            int value;
+            while (!stop.load())
+            {
+                // a lookup always sees a complete entry: 'alpha' and 'beta' are never deleted
+                if (!routes.tryGetValue("alpha", value) || !routes.tryGetValue(string_view{"beta"}, value))
+                    throw runtime_error{"Lookup failed."};
+
+                lookups.fetch_add(1, memory_order_relaxed);
+            }
+        });
+
+    for (int i = 0; i < 10000; i++)
+    {
+        routes.put("alpha", i);
+        routes.put("key" + to_string(i % 100), i);
+        routes.removal("key" + to_string((i + 50) % 100));
+    }
+
+    stop.store(true);
+    for (auto &reader : readers)
+        reader.join();
+
+    cout << "Lookups during the updates: " << (lookups.load() > 0 ? "some" : "none") << endl;
+    cout << "The value of key alpha is " << routes.getValue("alpha") << endl;
+    cout << "How many elements do we have? Answer: " << routes.getElements() << endl;
+    cout << "Does the key gamma exist? Answer: " << boolalpha << routes.contains("gamma") << endl;
+
+    routes.removal("gamma");
+    cout << "Does the key gamma exist? Answer: " << routes.contains("gamma") << endl;
+}
\ No newline at end of file
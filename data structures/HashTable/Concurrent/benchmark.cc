@@ -0,0 +1,92 @@
+/**
+ * A benchmark that compares the throughput of the ConcurrentMap with a SeparateChaining table protected by a
+ * global mutex. Every thread runs a mix of lookups and puts on random keys of a prefilled map; the share of
+ * lookups is 50%, 90% and 99% and the number of threads goes from 1 to 32.
+ * Compile with -pthread.
+*/
+
+#include "concurrentMap.hpp"
+#include <chrono>
+#include <thread>
+
+// a SeparateChaining table protected by a global mutex
+struct LockedTable
+{
+    mutex lock;
+    SeparateChaining<int, int> table{16};
+
+    void put(int key, int value)
+    {
+        lock_guard<mutex> guard{lock};
+        table.put(key, value);
+    }
+
+    bool tryGetValue(int key, int &value)
+    {
+        lock_guard<mutex> guard{lock};
+        const int *found = table.find(key);
+        if (found != nullptr)
+            value = *found;
+
+        return found != nullptr;
+    }
+};
+
+// runs 'opsPerThread' operations on 'threads' threads and returns the million operations per second
+template <typename Map>
+double run(Map &map, int keys, int readPercentage, int threads, int opsPerThread)
+{
+    for (int i = 0; i < keys; i++)
+        map.put(i, i);
+
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&map, keys, readPercentage, t, opsPerThread]() {
+            unsigned int state = t + 1;
+            int value;
+
+            for (int i = 0; i < opsPerThread; i++)
+            {
+                state = state * 1103515245 + 12345;
+                int key = (state >> 8) % keys;
+
+                if (static_cast<int>(state % 100) < readPercentage)
+                    map.tryGetValue(key, value);
+                else
+                    map.put(key, i);
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return static_cast<double>(threads) * opsPerThread / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    const int keys = 1000000;
+    const int opsPerThread = 500000;
+
+    for (int readPercentage : {50, 90, 99})
+    {
+        cout << readPercentage << "% lookups" << endl;
+        cout << "threads\tglobal mutex (Mops/s)\tConcurrentMap (Mops/s)" << endl;
+
+        for (int threads = 1; threads <= 32; threads *= 2)
+        {
+            LockedTable locked;
+            ConcurrentMap<int, int> concurrent{64};
+
+            double lockedThroughput = run(locked, keys, readPercentage, threads, opsPerThread);
+            double concurrentThroughput = run(concurrent, keys, readPercentage, threads, opsPerThread);
+
+            cout << threads << "\t" << lockedThroughput << "\t\t\t" << concurrentThroughput << endl;
+        }
+    }
+}
\ No newline at end of file
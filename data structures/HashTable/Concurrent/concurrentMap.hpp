@@ -0,0 +1,204 @@
+#ifndef CONCURRENT_MAP_HPP
+#define CONCURRENT_MAP_HPP
+
+#include "../Separate Chaining/separateChaining.hpp"
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <mutex>
+
+/**
+ * A thread-safe hash map composed of a power-of-two number of shards. Every shard is an independent
+ * SeparateChaining table protected by its own reader-writer lock: lookups of different threads share the lock,
+ * modifications take it exclusively. Operations on keys of different shards never wait for each other, and every
+ * shard grows and shrinks on its own (optionally with the incremental resize of SeparateChaining), so a resize
+ * only blocks the keys of one shard.
+ * The shard of a key is selected by the upper bits of a differently mixed hash code. SeparateChaining uses the upper
+ * bits of the hash code multiplied by the golden ratio as bucket index; if the shards used the same bits, all keys
+ * of a shard would share the upper bits of their bucket index and occupy only a fraction of the buckets.
+ * 'getElements' sums the per-shard counters without taking a lock, so it is only approximate while other threads
+ * modify the map.
+ * Values are returned by copy, since a pointer into a shard would not be protected by its lock.
+*/
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
+class ConcurrentMap
+{
+    // a shard: a table with its own lock, aligned to a cache line to avoid false sharing
+    struct alignas(64) Shard
+    {
+        mutable shared_mutex lock;
+        SeparateChaining<Key, Value, Hash> table;
+
+        // holds the number of key-value pairs of the shard (written under the lock, read without it)
+        atomic<long> elements{0};
+
+        Shard(int size, SeparateChainingOptions options, Hash hasher) : table{size, options, hasher} {}
+    };
+
+    // holds the number of shards (a power of two)
+    int nrOfShards;
+
+    // the shards
+    vector<unique_ptr<Shard>> shards;
+
+    // our hasher which we'll use for selecting a shard
+    Hash hasher;
+
+    // method that returns the shard of a key
+    template <typename K>
+    Shard &shardOf(const K &key) const
+    {
+        // mix the hash code with the finalizer of MurmurHash3, which is independent of the fibonacci
+        // hashing used for the bucket index, and take the upper bits
+        unsigned long long h = hasher(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+
+        return nrOfShards == 1 ? *shards[0] : *shards[h >> (64 - __builtin_ctz(nrOfShards))];
+    }
+
+public:
+    // constructor; 'size' is the initial size of the whole map, which is divided among the shards, and
+    // 'options' are passed to the table of every shard
+    ConcurrentMap(int nrOfShards = 64, int size = 0, SeparateChainingOptions options = SeparateChainingOptions(),
+                  Hash hasher = Hash())
+        : hasher{hasher}
+    {
+        // Sanity checks
+        if (nrOfShards <= 0 || size < 0)
+            throw invalid_argument{"Invalid argument: nr of shards <= 0 OR size < 0."};
+
+        // the number of shards is the next power of two
+        this->nrOfShards = 1;
+        while (this->nrOfShards < nrOfShards)
+            this->nrOfShards *= 2;
+
+        for (int i = 0; i < this->nrOfShards; i++)
+            shards.push_back(make_unique<Shard>(size / this->nrOfShards, options, hasher));
+    }
+
+    // method to get the number of shards
+    int getNrOfShards() const
+    {
+        return nrOfShards;
+    }
+
+    // method to get the number of key-value pairs; only approximate while other threads modify the map
+    long getElements() const
+    {
+        long elements = 0;
+        for (const auto &shard : shards)
+            elements += shard->elements.load(memory_order_relaxed);
+
+        return elements;
+    }
+
+    // method to check if the map is (approximately) empty
+    bool isEmpty() const
+    {
+        return getElements() == 0;
+    }
+
+    // method to check if the map contains a given key
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        Shard &shard = shardOf(key);
+        shared_lock<shared_mutex> guard{shard.lock};
+
+        return shard.table.contains(key);
+    }
+
+    // method to copy the value of a given key into 'value'; returns false if the key does not exist
+    template <typename K>
+    bool tryGetValue(const K &key, Value &value) const
+    {
+        Shard &shard = shardOf(key);
+        shared_lock<shared_mutex> guard{shard.lock};
+
+        const Value *found = shard.table.find(key);
+        if (found == nullptr)
+            return false;
+
+        value = *found;
+        return true;
+    }
+
+    // method to get the value of a given key
+    template <typename K>
+    Value getValue(const K &key) const
+    {
+        Value value;
+
+        // if key-value pair is not in the map, an exception is thrown
+        if (!tryGetValue(key, value))
+            throw runtime_error{"No value: key-value pair does not exist."};
+
+        return value;
+    }
+
+    // method to put a key-value pair into the map; an existing value is replaced
+    void put(Key key, Value value)
+    {
+        Shard &shard = shardOf(key);
+        unique_lock<shared_mutex> guard{shard.lock};
+
+        auto [slot, inserted] = shard.table.tryEmplace(move(key), move(value));
+
+        // the value is only moved by 'tryEmplace' if the key was inserted
+        if (!inserted)
+            *slot = move(value);
+        else
+            shard.elements.store(shard.elements.load(memory_order_relaxed) + 1, memory_order_relaxed);
+    }
+
+    // method to insert a key-value pair if the key does not exist yet; returns false if it already exists
+    bool insert(Key key, Value value)
+    {
+        Shard &shard = shardOf(key);
+        unique_lock<shared_mutex> guard{shard.lock};
+
+        bool inserted = shard.table.tryEmplace(move(key), move(value)).second;
+        if (inserted)
+            shard.elements.store(shard.elements.load(memory_order_relaxed) + 1, memory_order_relaxed);
+
+        return inserted;
+    }
+
+    // method to apply 'function' to the value of a given key under the lock of its shard; a default value is
+    // inserted first if the key does not exist (e.g. map.update(word, [](int &count) { count++; }))
+    template <typename Function>
+    void update(Key key, Function function)
+    {
+        Shard &shard = shardOf(key);
+        unique_lock<shared_mutex> guard{shard.lock};
+
+        auto [slot, inserted] = shard.table.tryEmplace(move(key));
+        if (inserted)
+            shard.elements.store(shard.elements.load(memory_order_relaxed) + 1, memory_order_relaxed);
+
+        function(*slot);
+    }
+
+    // method to delete a key-value pair; returns false if the key does not exist
+    template <typename K>
+    bool removal(const K &key)
+    {
+        Shard &shard = shardOf(key);
+        unique_lock<shared_mutex> guard{shard.lock};
+
+        if (!shard.table.contains(key))
+            return false;
+
+        shard.table.removal(key);
+        shard.elements.store(shard.elements.load(memory_order_relaxed) - 1, memory_order_relaxed);
+
+        return true;
+    }
+};
+
+#endif
\ No newline at end of file
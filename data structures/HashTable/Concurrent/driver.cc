@@ -0,0 +1,43 @@
+/**
+ * The client that tests the functionalities of the ConcurrentMap class.
+ * Compile with -pthread.
+*/
+
+#include "concurrentMap.hpp"
+#include <string>
+#include <thread>
+
+int main()
+{
+    ConcurrentMap<string, int> wordCounts{8};
+    cout << "Number of shards: " << wordCounts.getNrOfShards() << endl;
+
+    // four threads count the same words concurrently
+    vector<string> words{"to", "be", "or", "not", "to", "be"};
+    vector<thread> workers;
+    for (int t = 0; t < 4; t++)
+        workers.emplace_back([&wordCounts, &words]() {
+            for (int i = 0; i < 1000; i++)
+                for (const auto &word : words)
+                    wordCounts.update(word, [](int &count) { count++; });
+        });
+
+    for (auto &worker : workers)
+        worker.join();
+
+    for (string word : {"to", "be", "or", "not"})
+        cout << "The word " << word << " occurs " << wordCounts.getValue(word) << " times." << endl;
+
+    cout << "How many elements do we have? Answer: " << wordCounts.getElements() << endl;
+
+    // a lookup with a string_view
+    int count;
+    if (wordCounts.tryGetValue(string_view{"not"}, count))
+        cout << "The word not occurs " << count << " times." << endl;
+
+    wordCounts.put("be", 1);
+    cout << "Was the key or inserted? Answer: " << boolalpha << wordCounts.insert("or", 1) << endl;
+    cout << "Was the key be removed? Answer: " << wordCounts.removal("be") << endl;
+    cout << "Does the key be exist? Answer: " << wordCounts.contains("be") << endl;
+    cout << "How many elements do we have? Answer: " << wordCounts.getElements() << endl;
+}
\ No newline at end of file
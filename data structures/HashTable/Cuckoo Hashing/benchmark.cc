@@ -0,0 +1,70 @@
+/**
+ * A benchmark that compares the lookups of the CuckooHashing class with those of the SwissTable class and the
+ * RobinHood class: every table holds the same keys and the same number of slots, and is about 90% full.
+ * Hits and misses are measured separately, since a cuckoo lookup for a missing key examines both buckets
+ * (and nothing else), whereas a probing table has to reach the end of a cluster.
+*/
+
+#include "cuckooHashing.hpp"
+#include "../Swiss Table/swissTable.hpp"
+#include "../Robin Hood/robinHood.hpp"
+#include <chrono>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+// looks up 'operations' present keys and 'operations' missing keys and prints the elapsed seconds
+template <typename Table>
+void run(const string &name, Table &table, int n, int operations)
+{
+    for (int i = 0; i < n; i++)
+        table.put(key(i), i);
+
+    auto start = chrono::steady_clock::now();
+
+    int hits = 0;
+    for (int i = 0; i < operations; i++)
+        hits += table.contains(key((i * 7919LL) % n));
+
+    chrono::duration<double> hitTime = chrono::steady_clock::now() - start;
+    start = chrono::steady_clock::now();
+
+    // the keys are non-negative, so the negative keys are missing
+    for (int i = 0; i < operations; i++)
+        hits += table.contains(-1 - i);
+
+    chrono::duration<double> missTime = chrono::steady_clock::now() - start;
+
+    if (hits != operations)
+        throw runtime_error{"Unexpected number of hits."};
+
+    cout << name << "\t" << hitTime.count() << "\t" << missTime.count() << endl;
+}
+
+int main()
+{
+    const int slots = 1 << 22;
+    const int n = slots / 10 * 9;
+    const int operations = 5000000;
+
+    cout << "table\thits (s)\tmisses (s)" << endl;
+
+    {
+        // 'slots' slots hold 'n' pairs without growing
+        CuckooHashing<int, int> table{n};
+        run("CuckooHashing", table, n, operations);
+    }
+
+    {
+        SwissTable<int, int> table{slots};
+        run("SwissTable", table, n, operations);
+    }
+
+    {
+        RobinHood<int, int> table{slots, 0.95};
+        run("RobinHood", table, n, operations);
+    }
+}
\ No newline at end of file
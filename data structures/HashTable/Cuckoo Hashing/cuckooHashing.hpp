@@ -0,0 +1,480 @@
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "../transparentHash.hpp"
+using namespace std;
+
+/**
+ * The CuckooHashing class implements a bucketized cuckoo hash table. Every key has two candidate buckets,
+ * selected by two independent hash functions, and every bucket has 4 slots; a key-value pair is always stored
+ * in one of the 8 slots of its two buckets. So, a lookup examines at most two buckets, no matter how full the
+ * table is. Both buckets are prefetched at the same time, and a bucket of small key-value pairs (e.g. two ints)
+ * fits into one cache line together with its metadata: a bit mask of the occupied slots and an 8-bit tag
+ * (fingerprint) of each key, so keys are only compared when their tags match.
+ * If both buckets of a new key are full, a breadth-first search over the displacement graph looks for the
+ * shortest path of moves (a pair moves to its other bucket) that ends in a bucket with a free slot; the pairs
+ * are then moved along the path, starting at its end. If no path is found, the pair is put into a small stash
+ * which lookups scan when it is not empty. Only when the stash is full, the table doubles its size.
+ * This way, the load factor reaches about 95% before the table grows.
+*/
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
+class CuckooHashing
+{
+    // a key-value pair
+    using Slot = pair<Key, Value>;
+
+    // holds the number of slots per bucket
+    static constexpr int slotsPerBucket = 4;
+
+    // holds the maximum number of buckets visited by the breadth-first search
+    static constexpr int maxSearchedBuckets = 512;
+
+    // holds the maximum number of key-value pairs in the stash
+    static constexpr int maxStashSize = 8;
+
+    // a bucket with its metadata, aligned to a cache line
+    struct alignas(64) Bucket
+    {
+        // bit i is set if slot i holds a key-value pair
+        unsigned char occupied;
+
+        // the tag of the key in each slot
+        unsigned char tags[slotsPerBucket];
+
+        // the slots; only the occupied slots hold a constructed key-value pair
+        alignas(Slot) unsigned char storage[slotsPerBucket * sizeof(Slot)];
+
+        Slot &slot(int i)
+        {
+            return *launder(reinterpret_cast<Slot *>(storage) + i);
+        }
+
+        const Slot &slot(int i) const
+        {
+            return *launder(reinterpret_cast<const Slot *>(storage) + i);
+        }
+    };
+
+    // the two candidate buckets and the tag of a key
+    struct Position
+    {
+        int first;
+        int second;
+        unsigned char tag;
+    };
+
+    // a bucket visited by the breadth-first search: the pair in slot 'slot' of the bucket visited at
+    // index 'parent' can move to this bucket
+    struct Step
+    {
+        int bucket;
+        int parent;
+        int slot;
+    };
+
+    // holds the number of key-value pairs
+    int elements;
+
+    // holds the number of buckets (a power of two)
+    int nrOfBuckets;
+
+    // the buckets
+    unique_ptr<Bucket[]> buckets;
+
+    // the key-value pairs that didn't find a slot
+    vector<Slot> stash;
+
+    // our hasher which we'll use for hashing
+    Hash hasher;
+
+    // method that computes the candidate buckets and the tag of a key
+    template <typename K>
+    Position locate(const K &key) const
+    {
+        unsigned long long h = hasher(key);
+        int shift = 64 - __builtin_ctz(nrOfBuckets);
+
+        // the first bucket: fibonacci hashing
+        int first = (h * 11400714819323198485ull) >> shift;
+
+        // the second bucket and the tag: the finalizer of MurmurHash3
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+
+        int second = h >> shift;
+
+        // the two buckets of a key are always different
+        if (second == first)
+            second ^= 1;
+
+        return {first, second, static_cast<unsigned char>(h)};
+    }
+
+    // method that returns the other candidate bucket of the key-value pair in slot 'i' of bucket 'b'
+    int alternateBucket(int b, int i) const
+    {
+        Position position = locate(buckets[b].slot(i).first);
+        return position.first == b ? position.second : position.first;
+    }
+
+    // method that returns the index of a free slot of a bucket, or -1
+    static int freeSlot(const Bucket &bucket)
+    {
+        unsigned int free = ~bucket.occupied & ((1u << slotsPerBucket) - 1);
+        return free == 0 ? -1 : __builtin_ctz(free);
+    }
+
+    // method that moves a key-value pair into a free slot
+    void place(int b, int i, Slot &&item, unsigned char tag)
+    {
+        Bucket &bucket = buckets[b];
+        new (&bucket.slot(i)) Slot{move(item)};
+        bucket.tags[i] = tag;
+        bucket.occupied |= 1u << i;
+    }
+
+    // method that destroys the key-value pair in slot 'i' of bucket 'b'
+    void destroy(int b, int i)
+    {
+        buckets[b].slot(i).~Slot();
+        buckets[b].occupied &= ~(1u << i);
+    }
+
+    // method that returns a pointer to the key-value pair of a key, or nullptr
+    template <typename K>
+    Slot *findSlot(const K &key) const
+    {
+        Position position = locate(key);
+
+        // load both buckets at the same time
+        __builtin_prefetch(&buckets[position.second]);
+
+        for (int b : {position.first, position.second})
+        {
+            Bucket &bucket = buckets[b];
+
+            for (int i = 0; i < slotsPerBucket; i++)
+                if ((bucket.occupied >> i & 1) && bucket.tags[i] == position.tag && bucket.slot(i).first == key)
+                    return &bucket.slot(i);
+        }
+
+        // the stash is usually empty
+        for (const Slot &item : stash)
+            if (item.first == key)
+                return const_cast<Slot *>(&item);
+
+        return nullptr;
+    }
+
+    // method that searches the shortest displacement path from one of the buckets of 'position' to a bucket
+    // with a free slot and moves the pairs along it; returns the freed slot of the first bucket of the
+    // path as {bucket, slot}, or {-1, -1} if there is no path
+    pair<int, int> makeRoom(const Position &position)
+    {
+        vector<Step> visited{{position.first, -1, -1}, {position.second, -1, -1}};
+
+        for (int head = 0; head < static_cast<int>(visited.size()); head++)
+        {
+            int b = visited[head].bucket;
+            int free = freeSlot(buckets[b]);
+
+            if (free == -1)
+            {
+                // every pair of the full bucket could move to its other bucket
+                for (int i = 0; i < slotsPerBucket && static_cast<int>(visited.size()) < maxSearchedBuckets; i++)
+                    visited.push_back({alternateBucket(b, i), head, i});
+
+                continue;
+            }
+
+            // move the pairs along the path, starting at its end
+            int target = head;
+            while (visited[target].parent != -1)
+            {
+                const Step &step = visited[target];
+                int from = visited[step.parent].bucket;
+
+                // a bucket may occur twice on the path; then a pair might have been replaced by an earlier
+                // move, so make sure that the pair can still move to the target bucket
+                if (alternateBucket(from, step.slot) != step.bucket)
+                    return {-1, -1};
+
+                Bucket &source = buckets[from];
+                place(step.bucket, free, move(source.slot(step.slot)), source.tags[step.slot]);
+                destroy(from, step.slot);
+
+                free = step.slot;
+                target = step.parent;
+            }
+
+            return {visited[target].bucket, free};
+        }
+
+        return {-1, -1};
+    }
+
+    // method that inserts a key-value pair whose key is not in the table; returns false if neither a
+    // slot nor a place in the stash was found (then the pair is not moved from)
+    bool tryInsert(Slot &item)
+    {
+        Position position = locate(item.first);
+
+        // a free slot in one of the two buckets
+        for (int b : {position.first, position.second})
+        {
+            int free = freeSlot(buckets[b]);
+            if (free != -1)
+            {
+                place(b, free, move(item), position.tag);
+                return true;
+            }
+        }
+
+        // a displacement path
+        auto [b, free] = makeRoom(position);
+        if (b != -1)
+        {
+            place(b, free, move(item), position.tag);
+            return true;
+        }
+
+        // the stash
+        if (static_cast<int>(stash.size()) < maxStashSize)
+        {
+            stash.push_back(move(item));
+            return true;
+        }
+
+        return false;
+    }
+
+    // method that inserts a key-value pair whose key is not in the table and grows the table if necessary
+    void insert(Slot &item)
+    {
+        while (!tryInsert(item))
+            resize(2 * nrOfBuckets);
+    }
+
+    // method that destroys all key-value pairs of a bucket array
+    static void clear(Bucket *table, int tableSize)
+    {
+        for (int b = 0; b < tableSize; b++)
+            for (int i = 0; i < slotsPerBucket; i++)
+                if (table[b].occupied >> i & 1)
+                    table[b].slot(i).~Slot();
+    }
+
+    // used to resize the table to 'newSize' buckets; all pairs, including the stash, are reinserted
+    void resize(int newSize)
+    {
+        unique_ptr<Bucket[]> oldBuckets = move(buckets);
+        int oldSize = nrOfBuckets;
+
+        vector<Slot> oldStash;
+        oldStash.swap(stash);
+
+        nrOfBuckets = newSize;
+        buckets.reset(new Bucket[newSize]());
+
+        // the pairs that didn't fit into the new table
+        vector<Slot> leftovers;
+
+        for (int b = 0; b < oldSize; b++)
+            for (int i = 0; i < slotsPerBucket; i++)
+                if (oldBuckets[b].occupied >> i & 1)
+                    if (!tryInsert(oldBuckets[b].slot(i)))
+                        leftovers.push_back(move(oldBuckets[b].slot(i)));
+
+        for (Slot &item : oldStash)
+            if (!tryInsert(item))
+                leftovers.push_back(move(item));
+
+        clear(oldBuckets.get(), oldSize);
+
+        // very unlikely: grow again and insert the pairs that didn't fit
+        for (Slot &item : leftovers)
+            insert(item);
+    }
+
+public:
+    // constructor; 'size' is the number of key-value pairs the table can hold before it grows (approximately)
+    CuckooHashing(int size = 0, Hash hasher = Hash()) : elements{0}, hasher{hasher}
+    {
+        // the number of buckets is the next power of two
+        nrOfBuckets = 2;
+        while (nrOfBuckets * slotsPerBucket * 0.9 < size)
+            nrOfBuckets *= 2;
+
+        buckets.reset(new Bucket[nrOfBuckets]());
+    }
+
+    // the slots are owned by the table, so it can't be copied
+    CuckooHashing(const CuckooHashing &) = delete;
+    CuckooHashing &operator=(const CuckooHashing &) = delete;
+
+    // destructor
+    ~CuckooHashing()
+    {
+        clear(buckets.get(), nrOfBuckets);
+    }
+
+    // used to get the number of key-value pairs in the hash table
+    int getElements() const
+    {
+        return this->elements;
+    }
+
+    // used to get the number of slots (without the stash)
+    int getCapacity() const
+    {
+        return this->nrOfBuckets * slotsPerBucket;
+    }
+
+    // used to get the ratio of key-value pairs to slots
+    double getLoadFactor() const
+    {
+        return static_cast<double>(this->elements) / getCapacity();
+    }
+
+    // used to get the number of key-value pairs in the stash
+    int getStashSize() const
+    {
+        return stash.size();
+    }
+
+    // check if hash table is empty
+    bool isEmpty() const
+    {
+        return this->elements == 0;
+    }
+
+    // used to check if hashtable contains a given key
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        return findSlot(key) != nullptr;
+    }
+
+    // used to get a pointer to the value of a given key, or nullptr if the key does not exist
+    template <typename K>
+    Value *find(const K &key)
+    {
+        Slot *item = findSlot(key);
+        return item == nullptr ? nullptr : &item->second;
+    }
+
+    template <typename K>
+    const Value *find(const K &key) const
+    {
+        const Slot *item = findSlot(key);
+        return item == nullptr ? nullptr : &item->second;
+    }
+
+    // puts a key-value pair into the hash table
+    void put(Key key, Value value)
+    {
+        // if key already in hashTable, update its value
+        if (Slot *item = findSlot(key))
+        {
+            item->second = move(value);
+            return;
+        }
+
+        Slot item{move(key), move(value)};
+        insert(item);
+
+        // increment nr. of elements
+        this->elements++;
+    }
+
+    // used to delete a key-value pair
+    template <typename K>
+    void removal(const K &key)
+    {
+        Position position = locate(key);
+        bool removed = false;
+
+        for (int b : {position.first, position.second})
+            for (int i = 0; i < slotsPerBucket && !removed; i++)
+                if ((buckets[b].occupied >> i & 1) && buckets[b].tags[i] == position.tag && buckets[b].slot(i).first == key)
+                {
+                    destroy(b, i);
+                    removed = true;
+                }
+
+        for (int i = 0; i < static_cast<int>(stash.size()) && !removed; i++)
+            if (stash[i].first == key)
+            {
+                stash.erase(stash.begin() + i);
+                removed = true;
+            }
+
+        // no need to remove, when key does not exist
+        if (!removed)
+            return;
+
+        // decrement the nr of key-value pairs
+        this->elements--;
+
+        // a pair of the stash might fit into the freed slot
+        for (int i = 0; i < static_cast<int>(stash.size()); i++)
+        {
+            Position stashed = locate(stash[i].first);
+
+            for (int b : {stashed.first, stashed.second})
+            {
+                int free = freeSlot(buckets[b]);
+                if (free != -1)
+                {
+                    place(b, free, move(stash[i]), stashed.tag);
+                    stash.erase(stash.begin() + i--);
+                    break;
+                }
+            }
+        }
+
+        // guarantees that the hashTable is at least one-eight full; a table keeps at least two buckets, so
+        // every key has two different buckets
+        if (this->nrOfBuckets > 2 && this->elements > 0 && this->elements <= getCapacity() / 8)
+            resize(this->nrOfBuckets / 2);
+    }
+
+    // used to get the value of a given key
+    template <typename K>
+    Value getValue(const K &key) const
+    {
+        const Value *value = find(key);
+
+        // if key-value pair is not in hashTable, an exception is thrown
+        if (value == nullptr)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return *value;
+    }
+
+    // used to print the hash table content (only for debugging purposes)
+    void printHashTable()
+    {
+        for (int b = 0; b < this->nrOfBuckets; b++)
+        {
+            cout << "Bucket " << b << ": ";
+            for (int i = 0; i < slotsPerBucket; i++)
+                if (buckets[b].occupied >> i & 1)
+                    cout << "(" << buckets[b].slot(i).first << "," << buckets[b].slot(i).second << ") ";
+            cout << endl;
+        }
+
+        cout << "Stash: ";
+        for (const Slot &item : stash)
+            cout << "(" << item.first << "," << item.second << ") ";
+        cout << endl;
+    }
+};
\ No newline at end of file
@@ -0,0 +1,62 @@
+/**
+ * The client that tests the functionalities of the CuckooHashing class and shows the load factor it reaches
+ * before it grows.
+*/
+
+#include "cuckooHashing.hpp"
+#include <string>
+#include <random>
+
+int main()
+{
+    CuckooHashing<string, int> ch;
+    ch.put("Abdullah", 33);
+    ch.put("Abdullah", 36);
+
+    cout << "The value of key Abdullah is " << ch.getValue("Abdullah") << endl;
+
+    auto keyToSearch = "Abdullah";
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << ch.contains(keyToSearch) << endl;
+
+    ch.put("Arif", 28);
+    ch.put("Günther", 55);
+    ch.put("Klaus", 48);
+    ch.removal("Abdullah");
+
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << ch.contains(keyToSearch) << endl;
+    cout << "How many elements do we have in the hash table? Answer: " << ch.getElements() << endl;
+
+    ch.printHashTable();
+
+    // drain a small table: it never shrinks below two buckets
+    CuckooHashing<int, int> small{2};
+    for (int i = 0; i < 20; i++)
+        small.put(i, i);
+
+    for (int i = 0; i < 20; i++)
+        small.removal(i);
+
+    small.put(1, 1);
+    small.put(2, 2);
+    small.removal(1);
+    cout << "Drained table: " << small.getElements() << " element(s) in " << small.getCapacity() << " slots, contains 2? Answer: "
+         << small.contains(2) << endl;
+
+    // fill tables of different sizes with random keys until they grow, and print the load factor reached
+    // just before
+    mt19937_64 random;
+    for (int capacity = 1 << 10; capacity <= 1 << 22; capacity <<= 4)
+    {
+        CuckooHashing<long long, int> table{capacity};
+        int slots = table.getCapacity();
+
+        double loadFactor = 0;
+        while (table.getCapacity() == slots)
+        {
+            loadFactor = table.getLoadFactor();
+            table.put(random(), 0);
+        }
+
+        cout << "A table of " << slots << " slots grows at load factor " << loadFactor << endl;
+    }
+}
\ No newline at end of file
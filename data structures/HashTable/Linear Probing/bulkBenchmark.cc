@@ -0,0 +1,64 @@
+/**
+ * A benchmark that measures the time to load n key-value pairs (by default 2^24) into the LinearProbing class:
+ * with 'put' calls into a table that grows from a few slots, with 'put' calls after 'reserve', and with
+ * 'insertRange' using one thread and all hardware threads. 'reserve' and 'insertRange' size the table once,
+ * so they save the rehashing of the intermediate resizes.
+ * Usage: ./bulkBenchmark [n]
+*/
+
+#include "linearProbing.hpp"
+#include <chrono>
+#include <cstdlib>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+// runs 'load' on an empty table, checks that all pairs were inserted and prints the time
+template <typename Function>
+void run(const string &name, int n, Function load)
+{
+    LinearProbing<int, int> table{2};
+
+    auto start = chrono::steady_clock::now();
+    load(table);
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    if (table.getElements() != n)
+        throw runtime_error{"Benchmark failed: " + name + " lost key-value pairs."};
+
+    cout << name << "\t" << elapsed.count() << " s" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    const int n = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    const int threads = max(1u, thread::hardware_concurrency());
+
+    vector<pair<int, int>> pairs(n);
+    for (int i = 0; i < n; i++)
+        pairs[i] = {key(i), i};
+
+    cout << "load\t\t\ttime" << endl;
+
+    run("put\t\t", n, [&](LinearProbing<int, int> &table) {
+        for (auto &[key, value] : pairs)
+            table.put(key, value);
+    });
+
+    run("reserve + put\t", n, [&](LinearProbing<int, int> &table) {
+        table.reserve(n);
+        for (auto &[key, value] : pairs)
+            table.put(key, value);
+    });
+
+    run("insertRange\t", n, [&](LinearProbing<int, int> &table) {
+        table.insertRange(pairs.begin(), pairs.end());
+    });
+
+    run("insertRange x" + to_string(threads) + "\t", n, [&](LinearProbing<int, int> &table) {
+        table.insertRange(pairs.begin(), pairs.end(), threads);
+    });
+}
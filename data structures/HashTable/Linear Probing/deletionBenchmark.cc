@@ -0,0 +1,80 @@
+/**
+ * A benchmark that compares the two deletion modes of the LinearProbing class:
+ * - oscillation: the number of pairs repeatedly grows from n / 4 to n / 2 + 1 and shrinks back (by default
+ *   n = 2^20); with the default deletion, the table grows at the top and shrinks at the bottom of every cycle
+ * - churn: n / 4 pairs are kept while random pairs are deleted and new ones inserted
+ * For the tombstone deletion, the churn is run once without and once with a 'compact' call every n / 16 operations.
+ * Usage: ./deletionBenchmark [n]
+*/
+
+#include "linearProbing.hpp"
+#include <chrono>
+#include <cstdlib>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+// returns the seconds elapsed since 'start'
+double since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+// runs both workloads with the given deletion mode and prints their times
+void run(const string &name, int n, bool tombstoneDeletion, int compactInterval)
+{
+    const int cycles = 16;
+
+    LinearProbingOptions options;
+    options.tombstoneDeletion = tombstoneDeletion;
+
+    LinearProbing<int, int> oscillating{n / 2, options};
+    for (int i = 0; i < n / 4; i++)
+        oscillating.put(key(i), i);
+
+    auto start = chrono::steady_clock::now();
+
+    for (int cycle = 0; cycle < cycles; cycle++)
+    {
+        for (int i = n / 4; i <= n / 2; i++)
+            oscillating.put(key(i), i);
+
+        for (int i = n / 2; i >= n / 4; i--)
+            oscillating.removal(key(i));
+    }
+
+    double oscillation = since(start);
+
+    LinearProbing<int, int> churning{2, options};
+    for (int i = 0; i < n / 4; i++)
+        churning.put(key(i), i);
+
+    start = chrono::steady_clock::now();
+
+    // the oldest pair is deleted and a new one inserted, so the number of pairs stays the same
+    for (int i = 0; i < cycles * n / 4; i++)
+    {
+        churning.removal(key(i));
+        churning.put(key(i + n / 4), i);
+
+        if (compactInterval > 0 && i % compactInterval == 0)
+            churning.compact();
+    }
+
+    double churn = since(start);
+
+    cout << name << "\t" << oscillation << " s\t" << churn << " s" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    const int n = argc > 1 ? atoi(argv[1]) : 1 << 20;
+
+    cout << "deletion\t\toscillation\tchurn" << endl;
+    run("reinsert\t", n, false, 0);
+    run("tombstone\t", n, true, 0);
+    run("tombstone + compact", n, true, n / 16);
+}
@@ -1,28 +0,0 @@
-template <typename Key, typename Value>
-struct Element
-{
-    Element(Key key, Value value)
-    {
-        this->key = key;
-        this->value = value;
-    }
-
-    Key getKey() const
-    {
-        return this->key;
-    }
-
-    Value getValue() const
-    {
-        return this->value;
-    }
-
-    void setValue(Value newValue)
-    {
-        this->value = newValue;
-    }
-
-private:
-    Key key;
-    Value value;
-};
\ No newline at end of file
@@ -1,12 +1,24 @@
+#ifndef LINEAR_PROBING_HPP
+#define LINEAR_PROBING_HPP
+
 #include <vector>
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <exception>
-#include "element.hpp"
+#include <stdexcept>
+#include <utility>
+#include <memory>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include "../element.hpp"
+#include "../transparentHash.hpp"
+#include "../hashTableStats.hpp"
 using namespace std;
 
 /**
- * The LinearProbing class contains the logic to apply modular hashing using linear probing 
+ * The LinearProbing class contains the logic to apply hashing using linear probing 
  * (a method of open addressing) for collision resolution. Linear probing is a collision resolution 
  * strategy for handling the case when a hash table entry is already occupied. In that case, linear
  * probing just checks the next entry until an empty entry is found.
@@ -14,66 +26,391 @@ using namespace std;
  * The method 'put' is used to insert a key-value pair into the hash table and the method 'removal' is used
  * to delete a key-value pair from the hash table.
  * If we want to know the value of a key, we can use the 'getValue' method.
+ * The key-value pairs are stored inline in the hash table, so a lookup doesn't have to follow a pointer to
+ * a separately allocated element; a parallel vector holds the state of each slot (unoccupied or occupied).
+ * Only the occupied slots hold a constructed key-value pair, so allocating a table doesn't touch its slots.
+ * The methods 'find', 'tryEmplace' and 'getOrInsert' give access to the stored value with a single probe
+ * sequence. All lookups accept any key type the hasher and the key comparison accept, e.g. a string_view
+ * for string keys (see TransparentHash).
+ * The method 'getMany' looks up a batch of keys and prefetches the slots of the following keys, so the cache
+ * misses of several lookups overlap instead of being paid one after another.
+ * By default, a resize rehashes the whole table at once. In the incremental resize mode, a resize only
+ * allocates the new table and keeps the old one side by side with it; every later 'put', 'tryEmplace',
+ * 'getOrInsert' and 'removal' then moves the pairs of a bounded number of old slots to the new table
+ * (like Redis does), and lookups consult both tables until the old one is empty. Migrated or deleted slots
+ * of the old table are marked with tombstones, so the probe sequences of the remaining old pairs stay intact.
+ * By default, 'removal' reinserts the pairs of the cluster behind a deleted pair, and the table shrinks to one-half
+ * when it is one-eighth full. In the tombstone deletion mode, 'removal' only marks the slot with a tombstone, which
+ * lookups skip and insertions reuse, so a deletion takes constant time. The table shrinks only when it is
+ * one-sixteenth full, to one-quarter of its size, so a workload whose size oscillates around a threshold doesn't
+ * alternate between growing and shrinking. An insertion that finds the table one-half full including the
+ * tombstones rebuilds it (with the same size if most of the used slots are tombstones), and 'compact' lets the
+ * owner of the table drop the tombstones earlier, when they take up a given ratio of the slots.
+ * 'reserve' and 'insertRange' (or the constructor from a range) size the table once for a known number of pairs
+ * instead of growing it step by step. 'insertRange' can insert the pairs of a random access range into an empty
+ * table in parallel: the upper bits of the hash code (the index) split the slots into contiguous parts, one per
+ * thread, and a pair whose cluster runs past the end of its part is inserted afterwards.
+ * If HASH_TABLE_STATS is defined, the table collects statistics of its probe lengths and resizes, which
+ * 'statsToJson' exports (see HashTableStats).
 */
 
-template <typename Key, typename Value>
+// the options of a LinearProbing table; the defaults give a plain table, e.g.
+//     LinearProbingOptions options;
+//     options.incrementalResize = true;
+//     LinearProbing<int, int> table{2, options};
+struct LinearProbingOptions
+{
+    // whether a resize migrates the pairs incrementally (see above)
+    bool incrementalResize = false;
+
+    // whether 'removal' leaves a tombstone instead of reinserting the cluster behind the deleted pair (see above)
+    bool tombstoneDeletion = false;
+};
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
 class LinearProbing
 {
+    // the state of a slot in the hash table
+    enum SlotState : char
+    {
+        UNOCCUPIED,
+        OCCUPIED,
+        TOMBSTONE // the pair was deleted (in the tombstone deletion mode), or moved to the new table
+    };
+
     // holds the number of key-value pairs
     int elements;
 
-    // holds the size of the hash table
+    // holds the size of the hash table (always a power of two)
     int size;
 
-    // our hash table
-    vector<Element<Key, Value> *> hashTable;
+    // our hash table; only the occupied slots hold a constructed key-value pair
+    Element<Key, Value> *hashTable;
+
+    // the state of each slot in the hash table
+    vector<SlotState> states;
 
     // our hasher which we'll use for hashing
-    hash<Key> hasher;
+    Hash hasher;
+
+    // whether a resize migrates the pairs incrementally
+    bool incrementalResize;
+
+    // whether 'removal' marks the slot of a deleted pair with a tombstone instead of reinserting its cluster
+    bool tombstoneDeletion;
+
+    // holds the number of tombstones in the hash table (not counting the old hash table)
+    int tombstones;
+
+    // the old hash table, its slot states and its size during an incremental resize (otherwise empty)
+    Element<Key, Value> *oldHashTable;
+    vector<SlotState> oldStates;
+    int oldSize;
+
+    // the index of the next slot of the old hash table to be migrated
+    int migrationIndex;
+
+    // the number of old slots migrated by each modifying operation; with this step a migration is always
+    // finished before the table has to be resized again
+    static constexpr int migrationStep = 16;
+
+    // the number of keys 'getMany' prefetches ahead of the key it is resolving
+    static constexpr int prefetchDistance = 16;
+
+    // the opt-in statistics (empty unless HASH_TABLE_STATS is defined)
+    mutable HashTableStats stats;
+
+    // used to allocate the slots of a hash table without constructing them
+    static Element<Key, Value> *allocate(int slots)
+    {
+        return allocator<Element<Key, Value>>{}.allocate(slots);
+    }
+
+    // used to destroy the key-value pairs of a hash table and free its slots
+    static void deallocate(Element<Key, Value> *table, const vector<SlotState> &tableStates)
+    {
+        for (int i = 0; i < static_cast<int>(tableStates.size()); i++)
+            if (tableStates[i] == OCCUPIED)
+                table[i].~Element();
+
+        allocator<Element<Key, Value>>{}.deallocate(table, tableStates.size());
+    }
+
+    // used to prefetch the slot at the given index (and its state) into the cache
+    void prefetch(int i) const
+    {
+        __builtin_prefetch(&states[i]);
+        __builtin_prefetch(&hashTable[i]);
+    }
+
+    // used to apply fibonacci hashing for a table with 'tableSize' slots
+    template <typename K>
+    int hashing(const K &key, int tableSize) const
+    {
+        return (static_cast<unsigned long long>(hasher(key)) * 11400714819323198485ull) >> (64 - __builtin_ctz(tableSize));
+    }
+
+    // used to check whether an incremental resize is in progress
+    bool isMigrating() const
+    {
+        return !oldStates.empty();
+    }
+
+    // used to find the index of the slot of the old hash table holding the given key, or -1
+    template <typename K>
+    int findOldIndex(const K &key) const
+    {
+        if (!isMigrating())
+            return -1;
+
+        // tombstones don't end the cluster
+        for (auto i = hashing(key, oldSize); oldStates[i] != UNOCCUPIED; i = (i + 1) & (oldSize - 1))
+            if (oldStates[i] == OCCUPIED && oldHashTable[i].getKey() == key)
+                return i;
+
+        return -1;
+    }
+
+    // used to move the pairs of the next 'slots' slots of the old hash table to the new one
+    void migrate(int slots)
+    {
+        for (; slots > 0 && isMigrating(); slots--)
+        {
+            if (oldStates[migrationIndex] == OCCUPIED)
+            {
+                place(move(oldHashTable[migrationIndex]));
+                oldHashTable[migrationIndex].~Element();
+                oldStates[migrationIndex] = TOMBSTONE;
+            }
+
+            // the old hash table is released after its last slot has been migrated
+            if (++migrationIndex == oldSize)
+            {
+                deallocate(oldHashTable, oldStates);
+                oldHashTable = nullptr;
+                vector<SlotState>().swap(oldStates);
+            }
+        }
+    }
+
+    // used to find the index of the slot holding the given key, or -1
+    template <typename K>
+    int findIndex(const K &key) const
+    {
+        int probes = 1;
+
+        // scan through the cluster starting at the hash code of the key; tombstones don't end the cluster
+        for (auto i = hashing(key); states[i] != UNOCCUPIED; i = (i + 1) & (this->size - 1), probes++)
+            if (states[i] == OCCUPIED && hashTable[i].getKey() == key)
+            {
+                stats.recordProbe(probes);
+                return i;
+            }
+
+        stats.recordProbe(probes);
+        return -1;
+    }
+
+    // used to move a key-value pair whose key is not in the hash table to the first unoccupied slot (or
+    // tombstone) of its cluster
+    void place(Element<Key, Value> &&element)
+    {
+        int i{};
+
+        // apply linear probing to find an unoccupied location
+        for (i = hashing(element.getKey()); states[i] == OCCUPIED; i = (i + 1) & (this->size - 1))
+            ;
+
+        if (states[i] == TOMBSTONE)
+            this->tombstones--;
+
+        new (&hashTable[i]) Element<Key, Value>{move(element)};
+        states[i] = OCCUPIED;
+    }
 
     // used to resize the hashTable
     void resize(int newSize)
     {
+        auto timer = stats.startResize();
+
+        // a pending incremental resize is finished first
+        migrate(oldSize);
+
+        if (incrementalResize)
+        {
+            // keep the current hash table as the old one; its pairs are migrated by the following operations
+            oldHashTable = hashTable;
+            oldStates.swap(states);
+            oldSize = this->size;
+            migrationIndex = 0;
+
+            this->size = newSize;
+            hashTable = allocate(newSize);
+            states.assign(newSize, UNOCCUPIED);
+            this->tombstones = 0;
+
+            stats.recordResize(timer);
+            return;
+        }
+
         // set the new size of the hashTable
         this->size = newSize;
 
-        // create a temporary hash table
-        vector<Element<Key, Value> *> tmp;
-        tmp.assign(newSize, nullptr);
+        // create a temporary hash table and swap the contents
+        Element<Key, Value> *tmp = allocate(newSize);
+        vector<SlotState> tmpStates(newSize, UNOCCUPIED);
+        swap(hashTable, tmp);
+        states.swap(tmpStates);
+        this->tombstones = 0;
 
-        // scan through the hashTable
-        for (const auto element : hashTable)
-        {
-            // if element exists
-            if (element != nullptr)
+        // scan through the old hash table and move every key-value pair into the new one
+        for (int i = 0; i < static_cast<int>(tmpStates.size()); i++)
+            if (tmpStates[i] == OCCUPIED)
+                place(move(tmp[i]));
+
+        deallocate(tmp, tmpStates);
+
+        stats.recordResize(timer);
+    }
+
+    // used to insert the pairs of a random access range into the empty table with 'threads' threads
+    template <typename Iterator>
+    void parallelInsert(Iterator first, Iterator last, int threads)
+    {
+        int n = last - first;
+
+        // runs 'function(t)' for t = 0, ..., threads - 1 on 'threads' threads and rethrows the first exception
+        auto runParallel = [threads](auto function) {
+            vector<exception_ptr> errors(threads);
+            vector<thread> workers;
+
+            for (int t = 0; t < threads; t++)
+                workers.emplace_back([&, t] {
+                    try
+                    {
+                        function(t);
+                    }
+                    catch (...)
+                    {
+                        errors[t] = current_exception();
+                    }
+                });
+
+            for (thread &worker : workers)
+                worker.join();
+
+            for (exception_ptr &error : errors)
+                if (error)
+                    rethrow_exception(error);
+        };
+
+        // the home slot of every pair
+        vector<int> homes(n);
+        runParallel([&](int t) {
+            for (int i = static_cast<long>(n) * t / threads; i < static_cast<long>(n) * (t + 1) / threads; i++)
+                homes[i] = hashing((*(first + i)).first);
+        });
+
+        // the home slot 'home' belongs to the part home * threads / size of thread t, which are the slots
+        // up to (but without) slot ceil(size * (t + 1) / threads); the pairs are sorted by the part of their home
+        // slot (a counting sort, so the order of the pairs of a part is kept)
+        auto partOf = [&](int home) { return static_cast<long>(home) * threads / this->size; };
+
+        vector<int> offsets(threads + 1, 0);
+        for (int home : homes)
+            offsets[partOf(home) + 1]++;
+
+        for (int t = 0; t < threads; t++)
+            offsets[t + 1] += offsets[t];
+
+        vector<int> order(n);
+        vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (int i = 0; i < n; i++)
+            order[next[partOf(homes[i])]++] = i;
+
+        // every thread inserts the pairs of its part; a pair whose cluster reaches the end of the part is deferred
+        vector<vector<int>> deferred(threads);
+        vector<int> inserted(threads, 0);
+
+        runParallel([&](int t) {
+            int end = (static_cast<long>(this->size) * (t + 1) + threads - 1) / threads;
+
+            for (int j = offsets[t]; j < offsets[t + 1]; j++)
             {
-                // determine its hash code
-                auto hashCode = hashing(element->getKey());
+                auto &&item = *(first + order[j]);
+                int i = homes[order[j]];
 
-                // insert it into tmp
-                tmp[hashCode] = element;
-            }
-        }
+                // apply linear probing within the part; if key already in hashTable, update its value
+                while (i < end && states[i] == OCCUPIED && !(hashTable[i].getKey() == item.first))
+                    i++;
+
+                if (i == end)
+                    deferred[t].push_back(order[j]);
+
+                else if (states[i] == OCCUPIED)
+                    hashTable[i].getValue() = forward<decltype(item)>(item).second;
 
-        // clear the hash table
-        hashTable.clear();
+                else
+                {
+                    new (&hashTable[i]) Element<Key, Value>{forward<decltype(item)>(item).first, forward<decltype(item)>(item).second};
+                    states[i] = OCCUPIED;
+                    inserted[t]++;
+                }
+            }
+        });
 
-        // swap the contents
-        hashTable.swap(tmp);
+        for (int count : inserted)
+            this->elements += count;
 
-        // clear tmp since it is not needed anymore
-        tmp.clear();
+        // the deferred pairs are inserted in reverse order without overwriting a value: the last occurrence of a
+        // key wins, as if the pairs had been put one after another
+        for (int t = 0; t < threads; t++)
+            for (auto i = deferred[t].rbegin(); i != deferred[t].rend(); ++i)
+            {
+                auto &&item = *(first + *i);
+                tryEmplace(forward<decltype(item)>(item).first, forward<decltype(item)>(item).second);
+            }
     }
 
 public:
     // constructor
-    LinearProbing(int size) : elements{0}
+    LinearProbing(int size, Hash hasher = Hash()) : LinearProbing(size, LinearProbingOptions{}, hasher) {}
+
+    // constructor with options (see LinearProbingOptions)
+    LinearProbing(int size, LinearProbingOptions options, Hash hasher = Hash())
+        : elements{0}, hasher{hasher}, incrementalResize{options.incrementalResize}, tombstoneDeletion{options.tombstoneDeletion},
+          tombstones{0}, oldHashTable{nullptr}, oldSize{0}, migrationIndex{0}
+    {
+        // set the size of the hash table to the next power of two
+        this->size = 2;
+        while (this->size < size)
+            this->size *= 2;
+
+        // allocate the hash table with unoccupied slots
+        this->hashTable = allocate(this->size);
+        this->states.assign(this->size, UNOCCUPIED);
+    }
+
+    // constructor that inserts the key-value pairs of a range (see 'insertRange')
+    template <typename Iterator, typename = typename iterator_traits<Iterator>::iterator_category>
+    LinearProbing(Iterator first, Iterator last, int threads = 1, LinearProbingOptions options = LinearProbingOptions(),
+                  Hash hasher = Hash())
+        : LinearProbing(2, options, hasher)
+    {
+        insertRange(first, last, threads);
+    }
+
+    // the slots are owned by the table, so it can't be copied
+    LinearProbing(const LinearProbing &) = delete;
+    LinearProbing &operator=(const LinearProbing &) = delete;
+
+    // destructor
+    ~LinearProbing()
     {
-        // set the size of the hash table
-        this->size = size;
+        deallocate(hashTable, states);
 
-        // default initialize the hash table
-        this->hashTable.assign(this->size, nullptr);
+        if (isMigrating())
+            deallocate(oldHashTable, oldStates);
     }
 
     // used to get the number of key-value pairs in the hash table
@@ -88,129 +425,412 @@ public:
         return this->elements == 0 ? true : false;
     }
 
-    // used to apply modular hashing
-    int hashing(Key key)
+    // used to get the number of tombstones in the hash table
+    int getTombstones() const
+    {
+        return this->tombstones;
+    }
+
+    // check if an incremental resize is in progress
+    bool isResizing() const
+    {
+        return isMigrating();
+    }
+
+    // used to apply fibonacci hashing: the hash code is multiplied by 2^64 / golden ratio and the upper
+    // log2(size) bits of the product are used as index; this mixes the bits of weak hash codes (e.g. the
+    // identity hash of integers) and replaces the modulo by a shift
+    template <typename K>
+    int hashing(const K &key) const
     {
-        return hasher(key) % this->size;
+        return hashing(key, this->size);
     }
 
     // used to check if hashtable contains a given key
-    bool contains(Key key)
+    template <typename K>
+    bool contains(const K &key) const
     {
-        // scan through the hash table
-        for (auto i = hashing(key); hashTable[i] != nullptr; i = (i + 1) % this->size)
-            // if key is found, return true
-            if (hashTable[i]->getKey() == key)
-                return true;
+        return find(key) != nullptr;
+    }
 
-        // otherwise, return false
-        return false;
+    // used to get a pointer to the value of a given key, or nullptr if the key does not exist
+    template <typename K>
+    Value *find(const K &key)
+    {
+        return const_cast<Value *>(static_cast<const LinearProbing *>(this)->find(key));
     }
 
-    // puts a key-value pair into the hash table
-    void put(Key key, Value value)
+    template <typename K>
+    const Value *find(const K &key) const
     {
-        // guarantees that the hash table is at most one-half full
-        if (this->elements >= this->size / 2)
-            resize(2 * this->size);
+        int i = findIndex(key);
+        if (i != -1)
+            return &hashTable[i].getValue();
 
-        // the index where we store our key-value pair or just update its value
+        // during an incremental resize the key might still be in the old hash table
+        i = findOldIndex(key);
+        return i == -1 ? nullptr : &oldHashTable[i].getValue();
+    }
+
+    // used to insert a key with a value constructed from 'args' if the key does not exist yet
+    // returns a pointer to the value of the key and whether the key was inserted; 'args' are only used
+    // when the key is inserted
+    template <typename... Args>
+    pair<Value *, bool> tryEmplace(Key key, Args &&...args)
+    {
         int i{};
+        int tombstone = -1;
+        int probes = 1;
 
-        // apply linear probing to find an unoccupied location
-        for (i = hashing(key); hashTable[i] != nullptr; i = (i + 1) % this->size)
+        // do a step of a pending incremental resize
+        migrate(migrationStep);
+
+        // apply linear probing to find the key or the unoccupied location where it belongs; the whole cluster
+        // is searched for the key, but the first tombstone on the way is the location for a new pair
+        for (i = hashing(key); states[i] != UNOCCUPIED; i = (i + 1) & (this->size - 1), probes++)
         {
-            // if key already in hashTable
-            if (hashTable[i]->getKey() == key)
+            if (states[i] == TOMBSTONE)
             {
-                // update its value
-                hashTable[i]->setValue(value);
+                if (tombstone == -1)
+                    tombstone = i;
+            }
 
-                // and finish the linear probing
-                return;
+            // if key already in hashTable, return its value
+            else if (hashTable[i].getKey() == key)
+            {
+                stats.recordProbe(probes);
+                return {&hashTable[i].getValue(), false};
             }
         }
 
+        stats.recordProbe(probes);
+
+        // the key might still be in the old hash table
+        if (int j = findOldIndex(key); j != -1)
+            return {&oldHashTable[j].getValue(), false};
+
+        // reusing a tombstone doesn't fill the hash table any further
+        if (tombstone != -1 && this->elements < this->size / 2)
+        {
+            i = tombstone;
+            this->tombstones--;
+        }
+
+        // guarantees that the hash table is at most one-half full (including the tombstones); if most of the
+        // used slots are tombstones, the table is rebuilt with the same size; after a resize the unoccupied
+        // location has to be searched again
+        else if (this->elements + this->tombstones >= this->size / 2)
+        {
+            resize(this->elements >= this->size / 4 ? 2 * this->size : this->size);
+
+            for (i = hashing(key); states[i] == OCCUPIED; i = (i + 1) & (this->size - 1))
+                ;
+        }
+
         // store the key-value pair to the unoccupied location
-        hashTable[i] = new Element<Key, Value>{key, value};
+        new (&hashTable[i]) Element<Key, Value>{move(key), Value(forward<Args>(args)...)};
+        states[i] = OCCUPIED;
 
         // increment nr. of elements
         this->elements++;
+
+        return {&hashTable[i].getValue(), true};
     }
 
-    // used to delete a key-value pair
-    void removal(Key key)
+    // used to get a reference to the value of a given key; a default value is inserted if the key does not exist
+    Value &getOrInsert(Key key)
     {
-        // no need to remove, when key does not exist
-        if (!contains(key))
-            return;
+        return *tryEmplace(move(key)).first;
+    }
 
-        // determine the hash code
-        auto i = hashing(key);
+    // puts a key-value pair into the hash table
+    void put(Key key, Value value)
+    {
+        auto [slot, inserted] = tryEmplace(move(key), move(value));
 
-        // scan through the hash table to find the index of the key-value pair to be deleted
-        while (hashTable.at(i)->getKey() != key)
-            i = (i + 1) % this->size;
+        // if key already in hashTable, update its value
+        // (the value is only moved by 'tryEmplace' if the key was inserted)
+        if (!inserted)
+            *slot = move(value);
+    }
+
+    // used to make room for 'n' key-value pairs, so they can be inserted without a resize
+    void reserve(int n)
+    {
+        // a 'put' resizes when the hash table is one-half full
+        int newSize = this->size;
+        while (newSize / 2 < n)
+            newSize *= 2;
+
+        if (newSize > this->size)
+        {
+            // the pairs are rehashed right away, even in the incremental resize mode
+            resize(newSize);
+            migrate(oldSize);
+        }
+    }
+
+    // used to put the key-value pairs of a range (e.g. of a vector<pair<Key, Value>>; with move iterators the
+    // pairs are moved) into the hash table; if a key occurs more than once, its last value wins
+    // the table is sized once for the pairs of a forward range; the pairs of a random access range are inserted
+    // with 'threads' threads if the table is empty
+    template <typename Iterator>
+    void insertRange(Iterator first, Iterator last, int threads = 1)
+    {
+        using Category = typename iterator_traits<Iterator>::iterator_category;
 
-        // delete the key-value pair at index 'i'
-        hashTable[i] = nullptr;
+        if constexpr (is_base_of_v<forward_iterator_tag, Category>)
+            reserve(this->elements + distance(first, last));
+
+        if constexpr (is_base_of_v<random_access_iterator_tag, Category>)
+            if (threads > 1 && this->elements == 0 && this->tombstones == 0 && !isMigrating())
+            {
+                parallelInsert(first, last, threads);
+                return;
+            }
 
-        // now, we need to reinsert into the hash table all of the keys in the
-        // cluster to the right of the deleted key
-        i = (i + 1) % this->size;
-        while (hashTable[i] != nullptr)
+        for (; first != last; ++first)
         {
-            // save key and value for reinserting after deletion
-            Key k = hashTable[i]->getKey();
-            Value v = hashTable[i]->getValue();
+            auto &&item = *first;
+            put(forward<decltype(item)>(item).first, forward<decltype(item)>(item).second);
+        }
+    }
+
+    // used to delete a key-value pair
+    template <typename K>
+    void removal(const K &key)
+    {
+        // do a step of a pending incremental resize
+        migrate(migrationStep);
 
-            // delete
-            hashTable[i] = nullptr;
+        // determine the index of the key-value pair to be deleted
+        int i = findIndex(key);
 
-            // decrement the nr of key value pairs
-            this->elements--;
+        if (i != -1 && this->tombstoneDeletion)
+        {
+            // replace the key-value pair at index 'i' by a tombstone, so the probe sequences passing it stay intact
+            hashTable[i].~Element();
+            states[i] = TOMBSTONE;
+            this->tombstones++;
+
+            // if the cluster ends behind index 'i', no probe sequence passes the tombstones at its end, so they
+            // become unoccupied slots again
+            if (states[(i + 1) & (this->size - 1)] == UNOCCUPIED)
+                for (; states[i] == TOMBSTONE; i = (i - 1) & (this->size - 1))
+                {
+                    states[i] = UNOCCUPIED;
+                    this->tombstones--;
+                }
+        }
+
+        else if (i != -1)
+        {
+            // delete the key-value pair at index 'i' and release the memory it holds
+            hashTable[i].~Element();
+            states[i] = UNOCCUPIED;
 
-            // reinsert the element
-            put(k, v);
+            // now, we need to reinsert into the hash table all of the keys in the
+            // cluster to the right of the deleted key
+            for (i = (i + 1) & (this->size - 1); states[i] == OCCUPIED; i = (i + 1) & (this->size - 1))
+            {
+                // take the element out of the hash table and reinsert it
+                Element<Key, Value> element = move(hashTable[i]);
+                hashTable[i].~Element();
+                states[i] = UNOCCUPIED;
+                place(move(element));
+            }
+        }
 
-            // go to next element in the cluster
-            i = (i + 1) % this->size;
+        // during an incremental resize the key might still be in the old hash table, where the
+        // pair is replaced by a tombstone
+        else if ((i = findOldIndex(key)) != -1)
+        {
+            oldHashTable[i].~Element();
+            oldStates[i] = TOMBSTONE;
         }
 
+        // no need to remove, when key does not exist
+        else
+            return;
+
         // decrement the nr of key-value pairs
         this->elements--;
 
-        // guarantees that the hashTable is at least one-eight full
-        if (this->elements > 0 && this->elements <= this->size / 8)
+        // guarantees that the hashTable is at least one-eight full (one-sixteenth in the tombstone deletion
+        // mode, where it shrinks to one-quarter full)
+        if (this->tombstoneDeletion)
+        {
+            if (this->elements > 0 && this->elements <= this->size / 16)
+                resize(this->size / 4);
+        }
+
+        else if (this->elements > 0 && this->elements <= this->size / 8)
             resize(this->size / 2);
     }
 
+    // used to rebuild the hash table without tombstones if they take up more than 'maxTombstoneRatio' of its
+    // slots; returns whether the table is rebuilt
+    // the tombstones lengthen the probe sequences until an insertion rebuilds the table, so the owner of the table
+    // can call 'compact' at a convenient time (e.g. between two batches of operations); like every modifying method
+    // it isn't thread-safe, so the caller must have exclusive access to the table (e.g. hold a lock which all other
+    // operations on the table take as well); in the incremental resize mode 'compact' only starts the rebuild, and
+    // the following operations migrate the pairs
+    bool compact(double maxTombstoneRatio = 0.125)
+    {
+        // Sanity checks
+        if (maxTombstoneRatio < 0 || maxTombstoneRatio >= 1)
+            throw invalid_argument{"Invalid argument: max tombstone ratio not in [0, 1)."};
+
+        if (this->tombstones <= maxTombstoneRatio * this->size)
+            return false;
+
+        // a table which is at most one-sixteenth full shrinks as well
+        resize(this->elements > 0 && this->elements <= this->size / 16 ? this->size / 4 : this->size);
+        return true;
+    }
+
     // used to get the value of a given key
-    Value getValue(Key key)
+    template <typename K>
+    Value getValue(const K &key) const
     {
-        for (auto i = hashing(key); hashTable[i] != nullptr; i = (i + 1) % this->size)
-            // if given key is found in hashtable, return its value
-            if (hashTable[i]->getKey() == key)
-                return hashTable[i]->getValue();
+        const Value *value = find(key);
 
         // if key-value pair is not in hashTable, an exception is thrown
-        throw runtime_error{"No value: key-value pair not exists."};
+        if (value == nullptr)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return *value;
     }
 
+    // used to look up a batch of keys: 'found[i]' tells whether 'keys[i]' exists and, if so, 'values[i]'
+    // holds its value
+    // the keys are hashed 'prefetchDistance' positions ahead of the key being resolved and their slots are
+    // prefetched right away, so by the time a key is resolved its slot is usually in the cache
+    template <typename K>
+    void getMany(const vector<K> &keys, vector<Value> &values, vector<bool> &found) const
+    {
+        int n = keys.size();
+        values.resize(n);
+        found.assign(n, false);
+
+        // the indices of the keys at positions i, ..., i + prefetchDistance - 1 (a ring buffer)
+        int indices[prefetchDistance];
+
+        // hash the first keys and prefetch their slots
+        for (int i = 0; i < min(prefetchDistance, n); i++)
+        {
+            indices[i] = hashing(keys[i]);
+            prefetch(indices[i]);
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            int index = indices[i % prefetchDistance];
+
+            // hash the key 'prefetchDistance' positions ahead and prefetch its slot
+            if (i + prefetchDistance < n)
+            {
+                indices[i % prefetchDistance] = hashing(keys[i + prefetchDistance]);
+                prefetch(indices[i % prefetchDistance]);
+            }
+
+            int probes = 1;
+
+            // scan through the cluster starting at the hash code of the key
+            for (int j = index; states[j] != UNOCCUPIED; j = (j + 1) & (this->size - 1), probes++)
+                if (states[j] == OCCUPIED && hashTable[j].getKey() == keys[i])
+                {
+                    values[i] = hashTable[j].getValue();
+                    found[i] = true;
+                    break;
+                }
+
+            stats.recordProbe(probes);
+
+            // during an incremental resize the key might still be in the old hash table
+            if (!found[i])
+                if (int j = findOldIndex(keys[i]); j != -1)
+                {
+                    values[i] = oldHashTable[j].getValue();
+                    found[i] = true;
+                }
+        }
+    }
+
+    // used to call 'function(key, value)' for every key-value pair, in no particular order
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        for (int i = 0; i < this->size; i++)
+            if (states[i] == OCCUPIED)
+                function(hashTable[i].getKey(), hashTable[i].getValue());
+
+        // the pairs of the old hash table which are not migrated yet
+        for (int i = 0; i < static_cast<int>(oldStates.size()); i++)
+            if (oldStates[i] == OCCUPIED)
+                function(oldHashTable[i].getKey(), oldHashTable[i].getValue());
+    }
+
+#ifdef HASH_TABLE_STATS
+    // used to get the statistics of the probe lengths and resizes
+    const HashTableStats &getStats() const
+    {
+        return stats;
+    }
+
+    // used to reset the statistics
+    void resetStats()
+    {
+        stats.reset();
+    }
+
+    // used to export the statistics as JSON; besides the counters, the table is scanned for the probe length
+    // each stored pair needs (1 for a pair at its home slot); the tombstones include those of the old hash table
+    string statsToJson() const
+    {
+        LengthHistogram displacements;
+        for (int i = 0; i < this->size; i++)
+            if (states[i] == OCCUPIED)
+                displacements.add(((i - hashing(hashTable[i].getKey())) & (this->size - 1)) + 1);
+
+        int tombstones = this->tombstones;
+        for (int i = 0; i < static_cast<int>(oldStates.size()); i++)
+        {
+            if (oldStates[i] == OCCUPIED)
+                displacements.add(((i - hashing(oldHashTable[i].getKey(), oldSize)) & (oldSize - 1)) + 1);
+
+            tombstones += oldStates[i] == TOMBSTONE;
+        }
+
+        return stats.toJson(this->elements, this->size + oldStates.size(), tombstones, "displacements", displacements);
+    }
+#endif
+
     // used to print the hash table content (only for debugging purposes)
     void printHashTable()
     {
-        int index{};
-        for (const auto element : hashTable)
+        for (int index = 0; index < this->size; index++)
         {
             cout << "Index " << index << ": ";
-            if (element != nullptr)
-                cout << "(" << element->getKey() << "," << element->getValue() << ")" << endl;
+            if (states[index] == OCCUPIED)
+                cout << "(" << hashTable[index].getKey() << "," << hashTable[index].getValue() << ")" << endl;
+
+            else if (states[index] == TOMBSTONE)
+                cout << "tombstone" << endl;
 
             else
                 cout << "unoccupied" << endl;
+        }
 
-            index++;
+        // the old hash table during an incremental resize
+        if (isMigrating())
+        {
+            cout << "Old hash table (migrated up to index " << migrationIndex << "):" << endl;
+            for (int index = migrationIndex; index < oldSize; index++)
+                if (oldStates[index] == OCCUPIED)
+                    cout << "Index " << index << ": (" << oldHashTable[index].getKey() << "," << oldHashTable[index].getValue() << ")" << endl;
         }
     }
-};
\ No newline at end of file
+};
+
+#endif
@@ -0,0 +1,290 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/**
+ * A snapshot is a file holding an open addressing hash table with string keys in a form that can be used
+ * without deserializing it: the function 'writeSnapshot' writes the key-value pairs of a LinearProbing or
+ * SeparateChaining table into a file, and the class MappedLinearProbing maps such a file into memory with
+ * 'mmap' and serves read-only lookups directly from the mapping. Loading a snapshot only validates its header,
+ * so the startup of a service no longer depends on the size of the table: the pages of the file are read
+ * on demand by the first lookups that touch them.
+ * File format (native byte order; all offsets are in bytes from the start of the file):
+ * - the header (SnapshotHeader), padded to 64 bytes
+ * - 'slots' fixed-size slots (SnapshotSlot), a linear probing table at most one-half full; an occupied slot
+ *   holds the hash code of its key, the position of the key in the blob and the value inline
+ * - the blob: the bytes of all keys, one after another
+ * The hash function (64-bit FNV-1a) is part of the format, because std::hash may differ between builds.
+ * The values are copied byte by byte, so they have to be trivially copyable (e.g. integers or PODs).
+*/
+
+// the header of a snapshot file
+struct SnapshotHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t valueSize;
+    uint64_t slots;
+    uint64_t elements;
+    uint64_t blobOffset;
+    uint64_t blobSize;
+};
+
+// a slot of a snapshot file; it is occupied if 'occupied' is 1
+template <typename Value>
+struct SnapshotSlot
+{
+    uint64_t hash;
+    uint64_t keyOffset;
+    uint32_t keyLength;
+    uint32_t occupied;
+    Value value;
+};
+
+// the identification of a snapshot file
+constexpr char snapshotMagic[8] = {'L', 'P', 'S', 'N', 'A', 'P', 0, 0};
+constexpr uint32_t snapshotVersion = 1;
+
+// the offset of the first slot
+constexpr uint64_t snapshotSlotsOffset = 64;
+
+// used to compute the 64-bit FNV-1a hash code of a key
+inline uint64_t snapshotHash(string_view key)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (unsigned char c : key)
+    {
+        h ^= c;
+        h *= 1099511628211ull;
+    }
+
+    return h;
+}
+
+// used to map the hash code of a key to a slot of a table with 'slots' slots (fibonacci hashing; FNV-1a
+// leaves the upper bits weak for short keys)
+inline uint64_t snapshotIndex(uint64_t h, uint64_t slots)
+{
+    return (h * 11400714819323198485ull) >> (64 - __builtin_ctzll(slots));
+}
+
+// used to write the key-value pairs of a table (LinearProbing or SeparateChaining) with string keys into a
+// snapshot file; the file is written under a temporary name and renamed at the end, so a reader never sees
+// a partially written snapshot
+template <template <typename, typename, typename> class Table, typename Value, typename Hash>
+void writeSnapshot(const Table<string, Value, Hash> &table, const string &path)
+{
+    static_assert(is_trivially_copyable_v<Value>, "A snapshot can only hold trivially copyable values.");
+
+    uint64_t elements = 0;
+    table.forEach([&](const string &, const Value &) { elements++; });
+
+    // the table is at most one-half full
+    uint64_t slots = 2;
+    while (slots < 2 * elements)
+        slots *= 2;
+
+    vector<SnapshotSlot<Value>> snapshotSlots(slots);
+    string blob;
+
+    table.forEach([&](const string &key, const Value &value) {
+        uint64_t h = snapshotHash(key);
+
+        // apply linear probing to find an unoccupied slot
+        uint64_t i = snapshotIndex(h, slots);
+        while (snapshotSlots[i].occupied)
+            i = (i + 1) & (slots - 1);
+
+        snapshotSlots[i] = {h, blob.size(), static_cast<uint32_t>(key.size()), 1, value};
+        blob += key;
+    });
+
+    SnapshotHeader header{};
+    memcpy(header.magic, snapshotMagic, sizeof(snapshotMagic));
+    header.version = snapshotVersion;
+    header.valueSize = sizeof(Value);
+    header.slots = slots;
+    header.elements = elements;
+    header.blobOffset = snapshotSlotsOffset + slots * sizeof(SnapshotSlot<Value>);
+    header.blobSize = blob.size();
+
+    char padding[snapshotSlotsOffset - sizeof(SnapshotHeader)] = {};
+
+    string temporaryPath = path + ".tmp";
+    ofstream file{temporaryPath, ios::binary | ios::trunc};
+
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(padding, sizeof(padding));
+    file.write(reinterpret_cast<const char *>(snapshotSlots.data()), slots * sizeof(SnapshotSlot<Value>));
+    file.write(blob.data(), blob.size());
+    file.close();
+
+    if (!file || rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        remove(temporaryPath.c_str());
+        throw runtime_error{"Snapshot failed: cannot write " + path + "."};
+    }
+}
+
+/**
+ * A read-only hash table with string keys served from a memory-mapped snapshot file (see above).
+ * Lookups accept any string-like key (a string, a string_view or a C string) and never copy the key.
+ * A lookup compares the stored hash code before it touches the key in the blob, so a lookup usually reads
+ * one slot and, for a hit, one key.
+*/
+
+template <typename Value>
+class MappedLinearProbing
+{
+    static_assert(is_trivially_copyable_v<Value>, "A snapshot can only hold trivially copyable values.");
+
+    // the mapped file
+    const char *data;
+    size_t length;
+
+    // the header, the slots and the blob inside the mapped file
+    const SnapshotHeader *header;
+    const SnapshotSlot<Value> *slots;
+    const char *blob;
+
+    // used to unmap the file and throw an exception telling why the snapshot can't be loaded
+    [[noreturn]] void fail(const string &path, const string &reason)
+    {
+        munmap(const_cast<char *>(data), length);
+        throw runtime_error{"Snapshot failed: " + path + " " + reason + "."};
+    }
+
+public:
+    // constructor; maps the snapshot file at 'path' and validates its header
+    MappedLinearProbing(const string &path)
+    {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw runtime_error{"Snapshot failed: cannot open " + path + "."};
+
+        struct stat status;
+        if (fstat(fd, &status) != 0 || status.st_size < static_cast<off_t>(snapshotSlotsOffset))
+        {
+            close(fd);
+            throw runtime_error{"Snapshot failed: " + path + " is not a snapshot."};
+        }
+
+        length = status.st_size;
+        void *mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // the mapping stays valid after the file is closed
+        close(fd);
+
+        if (mapping == MAP_FAILED)
+            throw runtime_error{"Snapshot failed: cannot map " + path + "."};
+
+        data = static_cast<const char *>(mapping);
+        header = reinterpret_cast<const SnapshotHeader *>(data);
+
+        if (memcmp(header->magic, snapshotMagic, sizeof(snapshotMagic)) != 0)
+            fail(path, "is not a snapshot");
+
+        if (header->version != snapshotVersion || header->valueSize != sizeof(Value))
+            fail(path, "has an incompatible version or value type");
+
+        // the sizes of the regions have to add up to the size of the file
+        if (header->slots < 2 || (header->slots & (header->slots - 1)) != 0 ||
+            header->slots > (length - snapshotSlotsOffset) / sizeof(SnapshotSlot<Value>) ||
+            header->blobOffset != snapshotSlotsOffset + header->slots * sizeof(SnapshotSlot<Value>) ||
+            header->blobSize != length - header->blobOffset)
+            fail(path, "is truncated or corrupted");
+
+        slots = reinterpret_cast<const SnapshotSlot<Value> *>(data + snapshotSlotsOffset);
+        blob = data + header->blobOffset;
+
+        // the lookups are random, so reading ahead would only waste memory
+        madvise(mapping, length, MADV_RANDOM);
+    }
+
+    // the mapping is owned by the table, so it can't be copied
+    MappedLinearProbing(const MappedLinearProbing &) = delete;
+    MappedLinearProbing &operator=(const MappedLinearProbing &) = delete;
+
+    // destructor
+    ~MappedLinearProbing()
+    {
+        munmap(const_cast<char *>(data), length);
+    }
+
+    // used to get the number of key-value pairs in the hash table
+    int getElements() const
+    {
+        return header->elements;
+    }
+
+    // used to get the number of slots
+    int getSize() const
+    {
+        return header->slots;
+    }
+
+    // check if hash table is empty
+    bool isEmpty() const
+    {
+        return header->elements == 0;
+    }
+
+    // used to get a pointer to the value of a given key (inside the mapped file), or nullptr if the key does
+    // not exist
+    const Value *find(string_view key) const
+    {
+        uint64_t h = snapshotHash(key);
+        uint64_t mask = header->slots - 1;
+
+        // scan through the cluster starting at the hash code of the key (at most once around the table, in
+        // case the file is corrupted)
+        uint64_t i = snapshotIndex(h, header->slots);
+        for (uint64_t probes = 0; probes < header->slots && slots[i].occupied; probes++, i = (i + 1) & mask)
+        {
+            const SnapshotSlot<Value> &slot = slots[i];
+
+            // the position of the key is checked against the blob, so a corrupted slot can't be followed
+            // outside the file
+            if (slot.hash == h && slot.keyLength == key.size() && slot.keyOffset <= header->blobSize &&
+                slot.keyLength <= header->blobSize - slot.keyOffset &&
+                memcmp(blob + slot.keyOffset, key.data(), key.size()) == 0)
+                return &slot.value;
+        }
+
+        return nullptr;
+    }
+
+    // used to check if hashtable contains a given key
+    bool contains(string_view key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    // used to get the value of a given key
+    Value getValue(string_view key) const
+    {
+        const Value *value = find(key);
+
+        // if key-value pair is not in hashTable, an exception is thrown
+        if (value == nullptr)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return *value;
+    }
+};
+
+#endif
\ No newline at end of file
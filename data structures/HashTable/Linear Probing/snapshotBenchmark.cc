@@ -0,0 +1,68 @@
+/**
+ * A benchmark that compares the two ways a service can get its table at startup: rebuilding a
+ * LinearProbing<string, int> table from the source data, and loading a snapshot of the table with
+ * MappedLinearProbing. It prints the time to get a usable table and the time of the lookups of all keys
+ * afterwards (the first lookups of the mapped table page in the file).
+ * Note: the snapshot was just written, so its pages are probably still in the page cache; after a reboot the
+ * first lookups read them from the disk instead.
+ * Usage: ./snapshotBenchmark [n] [path]
+*/
+
+#include "linearProbing.hpp"
+#include "snapshot.hpp"
+#include <chrono>
+#include <cstdlib>
+
+// looks up all keys, checks their values and returns the elapsed seconds
+template <typename Table>
+double lookUpAll(const Table &table, const vector<string> &keys)
+{
+    auto start = chrono::steady_clock::now();
+
+    for (int i = 0; i < static_cast<int>(keys.size()); i++)
+        if (table.getValue(keys[i]) != i)
+            throw runtime_error{"Unexpected value."};
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    string path = argc > 2 ? argv[2] : "snapshot.bin";
+
+    // the source data
+    vector<string> keys;
+    for (int i = 0; i < n; i++)
+        keys.push_back("customer-" + to_string(i * 2654435761u));
+
+    auto start = chrono::steady_clock::now();
+
+    LinearProbing<string, int> table{2};
+    for (int i = 0; i < n; i++)
+        table.put(keys[i], i);
+
+    chrono::duration<double> rebuildTime = chrono::steady_clock::now() - start;
+    double tableLookupTime = lookUpAll(table, keys);
+
+    start = chrono::steady_clock::now();
+    writeSnapshot(table, path);
+    chrono::duration<double> writeTime = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    MappedLinearProbing<int> mapped{path};
+    chrono::duration<double> loadTime = chrono::steady_clock::now() - start;
+
+    double mappedLookupTime = lookUpAll(mapped, keys);
+
+    if (mapped.getElements() != n || mapped.contains("customer-"))
+        throw runtime_error{"Unexpected snapshot."};
+
+    cout << "Pairs: " << n << endl;
+    cout << "Rebuild LinearProbing: " << rebuildTime.count() << " s, then lookups: " << tableLookupTime << " s" << endl;
+    cout << "Write snapshot: " << writeTime.count() << " s" << endl;
+    cout << "Load snapshot: " << loadTime.count() << " s, then lookups: " << mappedLookupTime << " s" << endl;
+
+    remove(path.c_str());
+}
\ No newline at end of file
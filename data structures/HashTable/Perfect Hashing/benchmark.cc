@@ -0,0 +1,73 @@
+/**
+ * A benchmark that builds a PerfectHashMap of n string keys (by default 2^22) with 1, 2, 4, ... threads up to
+ * the number of cores, and compares its lookups and its memory with a LinearProbing table holding the same keys.
+ * Compile with -pthread.
+ * Usage: ./benchmark [n]
+*/
+
+#include "perfectHashMap.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <string>
+
+// looks up 'operations' present keys and returns the elapsed seconds
+template <typename Table>
+double lookUp(const Table &table, const vector<string> &keys, int operations)
+{
+    int n = keys.size();
+    auto start = chrono::steady_clock::now();
+
+    int hits = 0;
+    for (int i = 0; i < operations; i++)
+        hits += table.contains(keys[(i * 7919LL) % n]);
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+    if (hits != operations)
+        throw runtime_error{"Unexpected number of hits."};
+
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    int operations = 5000000;
+    int cores = max(1u, thread::hardware_concurrency());
+
+    vector<pair<string, int>> pairs;
+    vector<string> keys;
+    for (int i = 0; i < n; i++)
+    {
+        keys.push_back("key-" + to_string(i * 2654435761u));
+        pairs.push_back({keys.back(), i});
+    }
+
+    cout << "threads\tbuild (s)" << endl;
+    for (int threads = 1; threads <= cores; threads *= 2)
+    {
+        auto start = chrono::steady_clock::now();
+        PerfectHashMap<string, int> table{pairs, threads};
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        cout << threads << "\t" << elapsed.count() << endl;
+    }
+
+    PerfectHashMap<string, int> perfect{pairs};
+
+    LinearProbing<string, int> linearProbing{2};
+    for (int i = 0; i < n; i++)
+        linearProbing.put(keys[i], i);
+
+    cout << "Lookups of " << operations << " keys: PerfectHashMap " << lookUp(perfect, keys, operations)
+         << " s, LinearProbing " << lookUp(linearProbing, keys, operations) << " s" << endl;
+
+    // LinearProbing grows when it is one-half full, so it ends up between one-half and one-quarter full
+    int linearProbingSlots = 2;
+    while (linearProbingSlots / 2 < n)
+        linearProbingSlots *= 2;
+
+    cout << "Slots per key: PerfectHashMap 1 (+ " << perfect.getMetadataBitsPerKey() << " bits), LinearProbing "
+         << static_cast<double>(linearProbingSlots) / n << endl;
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+/**
+ * The client that tests the functionalities of the PerfectHashMap class.
+ * Compile with -pthread.
+*/
+
+#include "perfectHashMap.hpp"
+#include <iostream>
+#include <string>
+
+int main()
+{
+    PerfectHashMap<string, int> ph{{{"Abdullah", 36}, {"Arif", 28}, {"Günther", 55}, {"Klaus", 48}, {"Linda", 39}}};
+
+    cout << "The value of key Abdullah is " << ph.getValue("Abdullah") << endl;
+
+    auto keyToSearch = "Jessica";
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << ph.contains(keyToSearch) << endl;
+    cout << "How many elements do we have in the map? Answer: " << ph.getElements() << endl;
+
+    // a key must not occur twice
+    try
+    {
+        PerfectHashMap<string, int> duplicate{{{"Arif", 28}, {"Arif", 29}}};
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << e.what() << endl;
+    }
+
+    // a large map built in parallel
+    const int n = 1000000;
+    vector<pair<int, int>> pairs;
+    for (int i = 0; i < n; i++)
+        pairs.push_back({i, 2 * i});
+
+    PerfectHashMap<int, int> large{move(pairs)};
+
+    for (int i = 0; i < n; i++)
+        if (large.getValue(i) != 2 * i)
+            throw runtime_error{"Unexpected value."};
+
+    cout << "Does the key " << n << " exist? Answer: " << large.contains(n) << endl;
+    cout << "Bits of the perfect hash function per key: " << large.getMetadataBitsPerKey() << endl;
+}
\ No newline at end of file
@@ -0,0 +1,429 @@
+#ifndef PERFECT_HASH_MAP_HPP
+#define PERFECT_HASH_MAP_HPP
+
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "../transparentHash.hpp"
+using namespace std;
+
+/**
+ * The PerfectHashMap class is a read-only hash map built once from a set of key-value pairs. It uses a minimal
+ * perfect hash function in the style of PTHash: every key is mapped to its own slot of an array with exactly as
+ * many slots as keys, so the table is 100% full and a lookup examines exactly one slot.
+ * The perfect hash function works like this: the keys are distributed over about 3.5n / log2(n) buckets (in a
+ * skewed way: 60% of the keys go to 30% of the buckets). Starting with the largest bucket, the builder searches
+ * a 'pilot' for every bucket, the smallest number such that hash(key) XOR hash(pilot) modulo m sends all keys of
+ * the bucket to slots which are still free. A lookup only has to read the pilot of its bucket to compute the
+ * slot. m is n / 0.99, which makes the search much faster; the few keys that land in the slots >= n are sent
+ * to the free slots < n through a small remapping array.
+ * The pilots are stored in a bit-packed array with just as many bits as the largest pilot needs, so the metadata
+ * is about 3 bits per key (see 'getMetadataBitsPerKey'); the keys and values are stored in the slots, so
+ * 'contains' can tell apart keys that are not in the map.
+ * The keys are split into partitions of about 2^17 keys by their hash code, and every partition gets its own
+ * perfect hash function. The partitions are built in parallel by 'threads' threads.
+*/
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
+class PerfectHashMap
+{
+    // a key-value pair
+    using Slot = pair<Key, Value>;
+
+    // holds the average number of keys of a partition
+    static constexpr int partitionSize = 1 << 17;
+
+    // the number of buckets is bucketFactor * n / log2(n); fewer buckets need less space, but longer searches
+    static constexpr double bucketFactor = 3.5;
+
+    // the ratio of keys to slots during the search
+    static constexpr double alpha = 0.99;
+
+    // the maximum number of pilots tried for a bucket before the partition is built again with another seed
+    static constexpr uint64_t maxPilot = 1 << 20;
+
+    // a partition with its own perfect hash function
+    struct Partition
+    {
+        // the index of the first slot of the partition and its number of keys
+        uint64_t offset;
+        uint64_t size;
+
+        // the number of slots during the search (m >= size)
+        uint64_t m;
+
+        // the number of buckets, and the number of buckets receiving 60% of the keys
+        uint64_t buckets;
+        uint64_t denseBuckets;
+
+        // the seed of the bucket and pilot hashes
+        uint64_t seed;
+
+        // the width of a pilot in bits, and the bit-packed pilots
+        int width;
+        vector<uint64_t> pilots;
+
+        // the slots < size that the keys at the positions >= size are sent to
+        vector<uint32_t> remap;
+    };
+
+    // the slots, the keys of partition i start at partitions[i].offset
+    vector<Slot> slots;
+
+    // the partitions
+    vector<Partition> partitions;
+
+    // our hasher which we'll use for hashing
+    Hash hasher;
+
+    // the finalizer of MurmurHash3
+    static uint64_t mix(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // maps a 64-bit number to [0, range) with a multiplication instead of a modulo
+    static uint64_t fastRange(uint64_t h, uint64_t range)
+    {
+        return static_cast<uint64_t>((static_cast<unsigned __int128>(h) * range) >> 64);
+    }
+
+    // computes the mixed hash code of a key
+    template <typename K>
+    uint64_t hashing(const K &key) const
+    {
+        return mix(hasher(key));
+    }
+
+    // returns the bucket of a hash code in a partition: 60% of the hash codes go to the dense buckets
+    static uint64_t bucketOf(const Partition &partition, uint64_t h)
+    {
+        uint64_t g = mix(h ^ partition.seed);
+        uint64_t low = static_cast<uint32_t>(g);
+
+        if (g < 0.6 * UINT64_MAX)
+            return (low * partition.denseBuckets) >> 32;
+
+        return partition.denseBuckets + ((low * (partition.buckets - partition.denseBuckets)) >> 32);
+    }
+
+    // returns the position of a hash code in [0, m) for a pilot; the multiplication by 2^64 / golden ratio
+    // carries all bits into the upper bits used by fastRange (otherwise two keys whose upper bits match
+    // would collide for every pilot), and it is cheaper than a modulo
+    static uint64_t positionOf(const Partition &partition, uint64_t h, uint64_t pilot)
+    {
+        return fastRange((h ^ mix(pilot + partition.seed)) * 11400714819323198485ull, partition.m);
+    }
+
+    // returns the pilot of a bucket
+    static uint64_t pilotOf(const Partition &partition, uint64_t bucket)
+    {
+        uint64_t bit = bucket * partition.width;
+        uint64_t word = bit >> 6;
+        int shift = bit & 63;
+
+        uint64_t pilot = partition.pilots[word] >> shift;
+        if (shift + partition.width > 64)
+            pilot |= partition.pilots[word + 1] << (64 - shift);
+
+        return pilot & ((1ull << partition.width) - 1);
+    }
+
+    // returns the index of the only slot a key can be in
+    template <typename K>
+    uint64_t slotOf(const K &key) const
+    {
+        uint64_t h = hashing(key);
+        const Partition &partition = partitions[fastRange(h, partitions.size())];
+
+        uint64_t position = positionOf(partition, h, pilotOf(partition, bucketOf(partition, h)));
+        if (position >= partition.size)
+            position = partition.remap[position - partition.size];
+
+        return partition.offset + position;
+    }
+
+    // searches the pilots of a partition whose keys have the given hash codes and computes the slot of every
+    // key; returns false if a bucket has no pilot below maxPilot (then the partition is built with another seed)
+    static bool search(Partition &partition, const vector<uint64_t> &hashes, vector<uint64_t> &positions)
+    {
+        uint64_t n = hashes.size();
+
+        // sort the keys by bucket
+        vector<pair<uint64_t, uint32_t>> keys(n);
+        for (uint64_t i = 0; i < n; i++)
+            keys[i] = {bucketOf(partition, hashes[i]), i};
+
+        sort(keys.begin(), keys.end());
+
+        // the ranges of the non-empty buckets in 'keys', the largest bucket first
+        vector<pair<uint32_t, uint32_t>> ranges;
+        for (uint64_t i = 0, j; i < n; i = j)
+        {
+            for (j = i + 1; j < n && keys[j].first == keys[i].first; j++)
+                ;
+
+            ranges.push_back({i, j});
+        }
+
+        stable_sort(ranges.begin(), ranges.end(), [](auto a, auto b) { return a.second - a.first > b.second - b.first; });
+
+        vector<uint64_t> bucketPilots(partition.buckets, 0);
+        vector<bool> taken(partition.m, false);
+        positions.resize(n);
+
+        for (auto [first, last] : ranges)
+        {
+            uint64_t pilot = 0;
+
+            for (;; pilot++)
+            {
+                if (pilot == maxPilot)
+                    return false;
+
+                // try the pilot: all keys of the bucket need a free slot, and different slots
+                uint32_t i = first;
+                for (; i < last; i++)
+                {
+                    uint64_t position = positionOf(partition, hashes[keys[i].second], pilot);
+                    if (taken[position])
+                        break;
+
+                    taken[position] = true;
+                    positions[keys[i].second] = position;
+                }
+
+                if (i == last)
+                    break;
+
+                // undo the slots taken by this pilot
+                for (uint32_t j = first; j < i; j++)
+                    taken[positions[keys[j].second]] = false;
+            }
+
+            bucketPilots[keys[first].first] = pilot;
+        }
+
+        // pack the pilots
+        uint64_t largest = *max_element(bucketPilots.begin(), bucketPilots.end());
+        partition.width = largest == 0 ? 1 : 64 - __builtin_clzll(largest);
+        partition.pilots.assign((partition.buckets * partition.width + 63) / 64 + 1, 0);
+
+        for (uint64_t b = 0; b < partition.buckets; b++)
+        {
+            uint64_t bit = b * partition.width;
+            partition.pilots[bit >> 6] |= bucketPilots[b] << (bit & 63);
+            if ((bit & 63) + partition.width > 64)
+                partition.pilots[(bit >> 6) + 1] |= bucketPilots[b] >> (64 - (bit & 63));
+        }
+
+        // send the keys at the positions >= n to the free slots < n
+        partition.remap.assign(partition.m - n, 0);
+
+        uint64_t free = 0;
+        for (uint64_t position = n; position < partition.m; position++)
+            if (taken[position])
+            {
+                while (taken[free])
+                    free++;
+
+                partition.remap[position - n] = free++;
+            }
+
+        for (uint64_t &position : positions)
+            if (position >= n)
+                position = partition.remap[position - n];
+
+        return true;
+    }
+
+    // builds the perfect hash function of a partition; 'hashes' are the hash codes of its keys and 'indices'
+    // the indices of its keys in 'slots'; sets target[indices[i]] to the slot of the i-th key
+    void build(Partition &partition, const vector<uint64_t> &hashes, const vector<uint64_t> &indices, vector<uint64_t> &target)
+    {
+        uint64_t n = hashes.size();
+
+        // keys with the same hash code can't be told apart by any pilot; the hash codes are sorted together with
+        // the positions of their keys, so only the keys of a run of equal hash codes have to be compared
+        vector<pair<uint64_t, uint64_t>> sorted(n);
+        for (uint64_t i = 0; i < n; i++)
+            sorted[i] = {hashes[i], i};
+
+        sort(sorted.begin(), sorted.end());
+
+        bool collision = false;
+        for (uint64_t first = 0, last = 0; first < n; first = last)
+        {
+            for (last = first + 1; last < n && sorted[last].first == sorted[first].first; last++)
+                ;
+
+            for (uint64_t i = first; i < last; i++)
+                for (uint64_t j = i + 1; j < last; j++)
+                    if (slots[indices[sorted[i].second]].first == slots[indices[sorted[j].second]].first)
+                        throw invalid_argument{"Invalid argument: duplicate key."};
+
+            collision |= last - first > 1;
+        }
+
+        if (collision)
+            throw runtime_error{"Build failed: two keys have the same hash code."};
+
+        // the number of buckets and slots of the partition
+        double log2n = n < 2 ? 1 : 63 - __builtin_clzll(n) + 1;
+        partition.size = n;
+        partition.m = max<uint64_t>(n / alpha, n + 1);
+        partition.buckets = max<uint64_t>(bucketFactor * n / log2n, 2);
+        partition.denseBuckets = max<uint64_t>(0.3 * partition.buckets, 1);
+
+        vector<uint64_t> positions;
+        for (uint64_t attempt = 0;; attempt++)
+        {
+            partition.seed = mix(partition.offset * 0x9E3779B97F4A7C15ull + attempt);
+            if (search(partition, hashes, positions))
+                break;
+        }
+
+        for (uint64_t i = 0; i < n; i++)
+            target[indices[i]] = partition.offset + positions[i];
+    }
+
+public:
+    // constructor; builds the map from the key-value pairs with 'threads' threads (0 means one thread per core)
+    // throws an exception if a key occurs more than once
+    PerfectHashMap(vector<Slot> pairs, int threads = 0, Hash hasher = Hash()) : slots{move(pairs)}, hasher{hasher}
+    {
+        uint64_t n = slots.size();
+        if (n == 0)
+            return;
+
+        if (threads <= 0)
+            threads = max(1u, thread::hardware_concurrency());
+
+        // distribute the keys over the partitions
+        uint64_t nrOfPartitions = (n + partitionSize - 1) / partitionSize;
+        partitions.resize(nrOfPartitions);
+
+        vector<vector<uint64_t>> hashes(nrOfPartitions);
+        vector<vector<uint64_t>> indices(nrOfPartitions);
+
+        for (uint64_t i = 0; i < n; i++)
+        {
+            uint64_t h = hashing(slots[i].first);
+            uint64_t p = fastRange(h, nrOfPartitions);
+            hashes[p].push_back(h);
+            indices[p].push_back(i);
+        }
+
+        for (uint64_t p = 0, offset = 0; p < nrOfPartitions; offset += hashes[p].size(), p++)
+            partitions[p].offset = offset;
+
+        // build the partitions in parallel; every thread takes the next partition that is not built yet
+        vector<uint64_t> target(n);
+        atomic<uint64_t> next{0};
+        vector<exception_ptr> errors(threads);
+
+        auto worker = [&](int t) {
+            try
+            {
+                for (uint64_t p; (p = next.fetch_add(1)) < nrOfPartitions;)
+                    build(partitions[p], hashes[p], indices[p], target);
+            }
+            catch (...)
+            {
+                errors[t] = current_exception();
+                next = nrOfPartitions;
+            }
+        };
+
+        vector<thread> workers;
+        for (int t = 1; t < threads; t++)
+            workers.emplace_back(worker, t);
+
+        worker(0);
+
+        for (thread &w : workers)
+            w.join();
+
+        for (exception_ptr &error : errors)
+            if (error)
+                rethrow_exception(error);
+
+        // move every key-value pair to its slot by following the cycles of the permutation
+        for (uint64_t i = 0; i < n; i++)
+            while (target[i] != i)
+            {
+                uint64_t j = target[i];
+                swap(slots[i], slots[j]);
+                swap(target[i], target[j]);
+            }
+    }
+
+    // used to get the number of key-value pairs
+    int getElements() const
+    {
+        return slots.size();
+    }
+
+    // check if the map is empty
+    bool isEmpty() const
+    {
+        return slots.empty();
+    }
+
+    // used to get the number of bits of the perfect hash function per key (the pilots, the remapping arrays
+    // and the partitions), without the slots
+    double getMetadataBitsPerKey() const
+    {
+        if (slots.empty())
+            return 0;
+
+        double bits = 0;
+        for (const Partition &partition : partitions)
+            bits += 64.0 * partition.pilots.size() + 32.0 * partition.remap.size() + 8.0 * sizeof(Partition);
+
+        return bits / slots.size();
+    }
+
+    // used to get a pointer to the value of a given key, or nullptr if the key does not exist
+    template <typename K>
+    const Value *find(const K &key) const
+    {
+        if (slots.empty())
+            return nullptr;
+
+        const Slot &slot = slots[slotOf(key)];
+        return slot.first == key ? &slot.second : nullptr;
+    }
+
+    // used to check if the map contains a given key
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    // used to get the value of a given key
+    template <typename K>
+    Value getValue(const K &key) const
+    {
+        const Value *value = find(key);
+
+        // if key-value pair is not in the map, an exception is thrown
+        if (value == nullptr)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return *value;
+    }
+};
+
+#endif
\ No newline at end of file
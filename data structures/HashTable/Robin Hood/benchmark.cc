@@ -0,0 +1,69 @@
+
+/**
+ * A benchmark that compares the RobinHood class with the LinearProbing class on a delete-heavy workload:
+ * a table is filled up to a given load factor and then keys are alternately removed and inserted, so the load
+ * factor stays the same, followed by lookups of missing keys.
+ * Note: LinearProbing resizes itself to stay at most one-half full, so it can only be measured at 50% load.
+*/
+
+#include "robinHood.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+#include <chrono>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+// runs the workload and returns the elapsed seconds
+template <typename Table>
+double run(Table &table, int n, int operations)
+{
+    for (int i = 0; i < n; i++)
+        table.put(key(i), i);
+
+    auto start = chrono::steady_clock::now();
+
+    // remove an old key and insert a new one
+    for (int i = 0; i < operations; i++)
+    {
+        table.removal(key(i));
+        table.put(key(n + i), i);
+    }
+
+    // look up keys which are not in the table
+    for (int i = 0; i < operations; i++)
+        if (table.contains(-1 - i))
+            throw runtime_error{"Unexpected key."};
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main()
+{
+    const int size = 1 << 20;
+    const int operations = 500000;
+
+    cout << "load factor\tLinearProbing (s)\tRobinHood (s)" << endl;
+
+    for (double loadFactor : {0.5, 0.75, 0.9})
+    {
+        int n = loadFactor * size - 1;
+
+        RobinHood<int, int> robinHood{size, 0.95};
+        double robinHoodTime = run(robinHood, n, operations);
+
+        if (loadFactor == 0.5)
+        {
+            // one slot more than 2 * n, so that the table doesn't resize
+            LinearProbing<int, int> linearProbing{2 * n + 2};
+            double linearTime = run(linearProbing, n, operations);
+
+            cout << loadFactor << "\t\t" << linearTime << "\t\t\t" << robinHoodTime << endl;
+        }
+        else
+            cout << loadFactor << "\t\t-\t\t\t" << robinHoodTime << endl;
+    }
+}
\ No newline at end of file
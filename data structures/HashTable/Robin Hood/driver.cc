@@ -0,0 +1,32 @@
+
+/**
+ * The client that tests the functionalities of the RobinHood class.
+*/
+
+#include "robinHood.hpp"
+#include <string>
+
+int main()
+{
+    RobinHood<string, int> rh{8};
+    rh.put("Abdullah", 33);
+    rh.put("Abdullah", 36);
+
+    cout << "The value of key Abdullah is " << rh.getValue("Abdullah") << endl;
+
+    auto keyToSearch = "Abdullah";
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << rh.contains(keyToSearch) << endl;
+
+    rh.put("Arif", 28);
+    rh.put("Günther", 55);
+    rh.put("Klaus", 48);
+    rh.put("Linda", 39);
+    rh.put("Jessica", 42);
+    rh.printHashTable();
+
+    cout << "++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++" << endl;
+    rh.removal("Abdullah");
+    rh.printHashTable();
+
+    cout << "How many elements do we have in the hash table? Answer: " << rh.getElements() << endl;
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+using namespace std;
+
+/**
+ * The RobinHood class is a variant of the LinearProbing class that applies Robin Hood hashing.
+ * Every occupied slot stores the distance of its key-value pair from the slot the key hashes to (its probe
+ * distance). When a new key-value pair is inserted and meets a pair with a smaller probe distance ("a richer
+ * pair"), the new pair takes the slot and the richer pair continues probing. This keeps the probe distances
+ * of all pairs close to each other, so the variance of the probe lengths stays small even at high load factors.
+ * Since the pairs of a cluster are ordered by their probe distance, a search for a missing key can stop as soon
+ * as it meets a pair with a smaller probe distance than its own.
+ * The method 'removal' deletes a pair with a backward shift: the following pairs of the cluster are moved one
+ * slot back until an empty slot or a pair at its home slot is reached; nothing is reinserted.
+ * Keys and values are stored inline and have to be default constructible.
+*/
+
+template <typename Key, typename Value>
+class RobinHood
+{
+    // holds the number of key-value pairs
+    int elements;
+
+    // holds the size of the hash table (a power of two)
+    int size;
+
+    // holds the maximum load factor before the table grows
+    double maxLoadFactor;
+
+    // the key-value pairs
+    vector<pair<Key, Value>> slots;
+
+    // the probe distance of the pair in each slot (-1 if the slot is empty)
+    vector<int> distances;
+
+    // our hasher which we'll use for hashing
+    hash<Key> hasher;
+
+    // used to resize the hash table
+    void resize(int newSize)
+    {
+        vector<pair<Key, Value>> oldSlots(newSize);
+        vector<int> oldDistances(newSize, -1);
+
+        oldSlots.swap(slots);
+        oldDistances.swap(distances);
+        this->size = newSize;
+
+        // reinsert every key-value pair
+        for (int i = 0; i < static_cast<int>(oldSlots.size()); i++)
+            if (oldDistances[i] != -1)
+                insert(move(oldSlots[i].first), move(oldSlots[i].second));
+    }
+
+    // used to insert a key-value pair whose key is not in the table yet
+    void insert(Key key, Value value)
+    {
+        int mask = this->size - 1;
+        int distance = 0;
+
+        for (int i = hashing(key);; i = (i + 1) & mask, distance++)
+        {
+            // an empty slot: store the pair we carry
+            if (distances[i] == -1)
+            {
+                slots[i] = {move(key), move(value)};
+                distances[i] = distance;
+                return;
+            }
+
+            // a richer pair: take its slot and continue with the richer pair
+            if (distances[i] < distance)
+            {
+                swap(key, slots[i].first);
+                swap(value, slots[i].second);
+                swap(distance, distances[i]);
+            }
+        }
+    }
+
+    // used to find the index of the slot holding the given key, or -1
+    int find(const Key &key) const
+    {
+        int mask = this->size - 1;
+
+        for (int i = hashing(key), distance = 0; distances[i] >= distance; i = (i + 1) & mask, distance++)
+            if (distances[i] == distance && slots[i].first == key)
+                return i;
+
+        return -1;
+    }
+
+public:
+    // constructor
+    RobinHood(int size, double maxLoadFactor = 0.9) : elements{0}, maxLoadFactor{maxLoadFactor}
+    {
+        // Sanity checks
+        if (maxLoadFactor <= 0 || maxLoadFactor >= 1)
+            throw invalid_argument{"Invalid argument: max load factor not in (0, 1)."};
+
+        // the size of the hash table is the next power of two
+        this->size = 2;
+        while (this->size < size)
+            this->size *= 2;
+
+        this->slots.resize(this->size);
+        this->distances.assign(this->size, -1);
+    }
+
+    // used to get the number of key-value pairs in the hash table
+    int getElements() const
+    {
+        return this->elements;
+    }
+
+    // used to get the size of the hash table
+    int getSize() const
+    {
+        return this->size;
+    }
+
+    // check if hash table is empty
+    bool isEmpty() const
+    {
+        return this->elements == 0;
+    }
+
+    // used to apply fibonacci hashing; the upper bits of the product are used as index
+    int hashing(const Key &key) const
+    {
+        return (hasher(key) * 11400714819323198485ull) >> (64 - __builtin_ctz(this->size));
+    }
+
+    // used to check if hashtable contains a given key
+    bool contains(const Key &key) const
+    {
+        return find(key) != -1;
+    }
+
+    // puts a key-value pair into the hash table
+    void put(Key key, Value value)
+    {
+        // if key already in hashTable, update its value
+        int i = find(key);
+        if (i != -1)
+        {
+            slots[i].second = move(value);
+            return;
+        }
+
+        // guarantees that the load factor stays below the maximum load factor
+        if (this->elements + 1 > this->maxLoadFactor * this->size)
+            resize(2 * this->size);
+
+        insert(move(key), move(value));
+
+        // increment nr. of elements
+        this->elements++;
+    }
+
+    // used to delete a key-value pair
+    void removal(const Key &key)
+    {
+        int i = find(key);
+
+        // no need to remove, when key does not exist
+        if (i == -1)
+            return;
+
+        int mask = this->size - 1;
+
+        // backward shift: move the following pairs of the cluster one slot back until we reach an empty
+        // slot or a pair that is already at its home slot
+        for (int next = (i + 1) & mask; distances[next] > 0; i = next, next = (next + 1) & mask)
+        {
+            slots[i] = move(slots[next]);
+            distances[i] = distances[next] - 1;
+        }
+
+        // the last slot of the shifted part becomes empty
+        slots[i] = {};
+        distances[i] = -1;
+
+        // decrement the nr of key-value pairs
+        this->elements--;
+
+        // guarantees that the hashTable is at least one-eight full
+        if (this->elements > 0 && this->elements <= this->size / 8)
+            resize(this->size / 2);
+    }
+
+    // used to get the value of a given key
+    Value getValue(const Key &key) const
+    {
+        int i = find(key);
+
+        // if key-value pair is not in hashTable, an exception is thrown
+        if (i == -1)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return slots[i].second;
+    }
+
+    // used to print the hash table content (only for debugging purposes)
+    void printHashTable()
+    {
+        for (int i = 0; i < this->size; i++)
+        {
+            cout << "Index " << i << ": ";
+            if (distances[i] != -1)
+                cout << "(" << slots[i].first << "," << slots[i].second << ") distance " << distances[i] << endl;
+
+            else
+                cout << "unoccupied" << endl;
+        }
+    }
+};
\ No newline at end of file
@@ -0,0 +1,69 @@
+/**
+ * A benchmark that compares single lookups with the batched lookup 'getMany' of the SeparateChaining class.
+ * The table holds n pseudo-random keys (by default 2^22, i.e. a few hundred MB of nodes and buckets), so
+ * it is much larger than the last level cache and nearly every lookup misses the cache. Each batch contains
+ * the same number of keys that are in the table and keys that are not.
+ * Usage: ./benchmark [n] [batch size]
+*/
+
+#include "separateChaining.hpp"
+#include <chrono>
+#include <cstdlib>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+int main(int argc, char *argv[])
+{
+    const int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+    const int batchSize = argc > 2 ? atoi(argv[2]) : 1 << 20;
+
+    SeparateChaining<int, int> table{n};
+    for (int i = 0; i < n; i++)
+        table.put(key(i), i);
+
+    // every second key of a batch is in the table; the two batches share no key, so the first
+    // measurement doesn't load the slots of the second one into the cache
+    vector<int> singleKeys(batchSize), batchKeys(batchSize);
+    for (int i = 0; i < batchSize; i++)
+    {
+        singleKeys[i] = i % 2 == 0 ? key((2 * i * 7919LL) % n) : -1 - 2 * i;
+        batchKeys[i] = i % 2 == 0 ? key((2 * i * 7919LL + 1) % n) : -2 - 2 * i;
+    }
+
+    // single lookups
+    auto start = chrono::steady_clock::now();
+
+    int singleHits = 0;
+    for (int key : singleKeys)
+        if (const int *value = table.find(key))
+            singleHits += *value >= 0;
+
+    chrono::duration<double> singleTime = chrono::steady_clock::now() - start;
+
+    // batched lookup; the output vectors are allocated before the measurement
+    vector<int> values(batchSize);
+    vector<bool> found(batchSize);
+
+    start = chrono::steady_clock::now();
+
+    table.getMany(batchKeys, values, found);
+
+    int batchHits = 0;
+    for (int i = 0; i < batchSize; i++)
+        if (found[i])
+            batchHits += values[i] >= 0;
+
+    chrono::duration<double> batchTime = chrono::steady_clock::now() - start;
+
+    // every second key has to be found
+    if (singleHits != (batchSize + 1) / 2 || batchHits != (batchSize + 1) / 2)
+        throw runtime_error{"Unexpected number of keys found."};
+
+    cout << "SeparateChaining with " << table.getNrOfElements() << " keys, " << batchSize << " lookups" << endl;
+    cout << "single lookups: " << singleTime.count() << " s" << endl;
+    cout << "getMany:        " << batchTime.count() << " s" << endl;
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "separateChaining.hpp"
 #include <string>
+#include <string_view>
 
 int main()
 {
@@ -21,8 +22,54 @@ int main()
     cout << "Is the hash table empty? Answer: " << sp->isEmpty() << endl;
 
     sp->printHashTable();
+
+    // count words with a single scan per word
+    SeparateChaining<string, int> counts{4};
+    for (string word : {"to", "be", "or", "not", "to", "be"})
+        counts.getOrInsert(word)++;
+
+    // look up a key with a string_view, without constructing a string
+    string_view view{"to be"};
+    if (const int *count = counts.find(view.substr(0, 2)))
+        cout << "The word to occurs " << *count << " times." << endl;
+
+    auto [value, inserted] = counts.tryEmplace("or", 10);
+    cout << "Was the key or inserted? Answer: " << inserted << ", its value is " << *value << endl;
+
+    // look up a batch of keys
+    vector<string> words{"to", "be", "it"};
+    vector<int> wordCounts;
+    vector<bool> found;
+    counts.getMany(words, wordCounts, found);
+    for (int i = 0; i < static_cast<int>(words.size()); i++)
+        cout << "Does the word " << words[i] << " occur? Answer: " << found[i] << (found[i] ? ", " + to_string(wordCounts[i]) + " times" : "") << endl;
+
     sp->removal("Abdullah");
     cout << "How many elements do we have? Answer: " << sp->getNrOfElements() << endl;
 
     sp->printHashTable();
+
+    // with the incremental resize, the pairs are migrated to the larger table by the following operations
+    SeparateChainingOptions incrementalOptions;
+    incrementalOptions.incrementalResize = true;
+
+    SeparateChaining<int, int> incremental{2, incrementalOptions};
+    for (int i = 0; i < 5; i++)
+    {
+        incremental.put(i, i * i);
+        cout << "Put " << i << ", is the hash table resizing? Answer: " << incremental.isResizing() << endl;
+    }
+    incremental.printHashTable();
+
+#ifdef HASH_TABLE_STATS
+    // the statistics (compile with -DHASH_TABLE_STATS)
+    SeparateChaining<int, int> measured{2};
+    for (int i = 0; i < 1000000; i++)
+        measured.put(i, i);
+
+    for (int i = 0; i < 2000000; i++)
+        measured.contains(i);
+
+    cout << measured.statsToJson() << endl;
+#endif
 }
\ No newline at end of file
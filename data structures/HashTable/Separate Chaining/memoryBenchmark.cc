@@ -0,0 +1,55 @@
+/**
+ * A benchmark that measures the memory use and the resize cost of the SeparateChaining class.
+ * A table grows from a few buckets to n key-value pairs (by default 20 million); the benchmark prints the
+ * resident memory per key-value pair, the total time and the time of the slowest 'put', which is the one
+ * that triggers the last resize.
+ * Usage: ./memoryBenchmark [n] (Linux only, the resident memory is read from /proc/self/statm)
+*/
+
+#include "separateChaining.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <unistd.h>
+
+// returns the resident memory of the process in bytes
+long residentMemory()
+{
+    long pages, residentPages;
+    ifstream statm{"/proc/self/statm"};
+    statm >> pages >> residentPages;
+
+    return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+int main(int argc, char *argv[])
+{
+    const int n = argc > 1 ? atoi(argv[1]) : 20000000;
+
+    long memoryBefore = residentMemory();
+    auto begin = chrono::steady_clock::now();
+
+    SeparateChaining<int, int> table{2};
+    double slowest = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        auto start = chrono::steady_clock::now();
+        table.put(key(i), i);
+        slowest = max(slowest, chrono::duration<double>(chrono::steady_clock::now() - start).count());
+    }
+
+    chrono::duration<double> total = chrono::steady_clock::now() - begin;
+    long memory = residentMemory() - memoryBefore;
+
+    cout << table.getNrOfElements() << " key-value pairs in " << table.getSize() << " buckets" << endl;
+    cout << "memory:        " << static_cast<double>(memory) / n << " bytes per key-value pair" << endl;
+    cout << "total time:    " << total.count() << " s" << endl;
+    cout << "slowest put:   " << slowest << " s" << endl;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * The class 'NodePool' is a slab allocator for the nodes of the SeparateChaining class.
+ * Instead of allocating every node on its own, the pool allocates slabs of nodes (the slab size doubles up to
+ * a maximum) and hands out their slots one after another. A released slot is put on a free list and reused by
+ * the next allocation. So, a node costs no allocator overhead, nodes allocated together lie next to each other
+ * in memory, and a table that deletes and inserts keys doesn't call the allocator at all.
+ * The pool doesn't know which slots are in use: the owner has to release all nodes before the pool is destroyed.
+ * A pool can take over the slabs of another pool ('absorb'), so several threads can allocate nodes from pools of
+ * their own and hand them to a single owner afterwards.
+*/
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+template <typename Node>
+class NodePool
+{
+    // a slot of a slab: either a node or the link to the next free slot
+    union Slot
+    {
+        Node node;
+        Slot *nextFree;
+
+        Slot() {}
+        ~Slot() {}
+    };
+
+    // holds the size of the first slab and the maximum size of a slab
+    static constexpr int firstSlabSize = 16;
+    static constexpr int maxSlabSize = 4096;
+
+    // the slabs
+    std::vector<std::unique_ptr<Slot[]>> slabs;
+
+    // holds the size of the last slab and the number of its slots handed out so far
+    int slabSize;
+    int usedSlots;
+
+    // the first free slot
+    Slot *freeList;
+
+public:
+    // constructor
+    NodePool() : slabSize{0}, usedSlots{0}, freeList{nullptr} {}
+
+    // the nodes are owned by the pool, so it can't be copied
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    // used to construct a node from 'args' in a free slot
+    template <typename... Args>
+    Node *allocate(Args &&...args)
+    {
+        Slot *slot = freeList;
+
+        if (slot != nullptr)
+            freeList = slot->nextFree;
+
+        else
+        {
+            // the last slab is full, so allocate a new one twice as large
+            if (usedSlots == slabSize)
+            {
+                slabSize = slabSize == 0 ? firstSlabSize : std::min(2 * slabSize, maxSlabSize);
+                slabs.emplace_back(new Slot[slabSize]);
+                usedSlots = 0;
+            }
+
+            slot = &slabs.back()[usedSlots++];
+        }
+
+        return new (&slot->node) Node{std::forward<Args>(args)...};
+    }
+
+    // used to take over the slabs of 'other', whose nodes then belong to this pool; 'other' is left empty
+    void absorb(NodePool &other)
+    {
+        if (other.slabs.empty())
+            return;
+
+        // the slots of the last slab of 'other' that were never handed out become free slots
+        for (int i = other.usedSlots; i < other.slabSize; i++)
+        {
+            Slot *slot = &other.slabs.back()[i];
+            slot->nextFree = other.freeList;
+            other.freeList = slot;
+        }
+
+        while (other.freeList != nullptr)
+        {
+            Slot *slot = other.freeList;
+            other.freeList = slot->nextFree;
+            slot->nextFree = freeList;
+            freeList = slot;
+        }
+
+        // the slabs of 'other' are placed before the last slab of this pool, which new slots are still taken from
+        slabs.insert(slabs.empty() ? slabs.end() : slabs.end() - 1, std::make_move_iterator(other.slabs.begin()),
+                     std::make_move_iterator(other.slabs.end()));
+
+        other.slabs.clear();
+        other.slabSize = 0;
+        other.usedSlots = 0;
+    }
+
+    // used to destroy a node and put its slot on the free list
+    void release(Node *node)
+    {
+        node->~Node();
+
+        Slot *slot = reinterpret_cast<Slot *>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+    }
+};
\ No newline at end of file
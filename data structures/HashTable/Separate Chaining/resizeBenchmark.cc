@@ -0,0 +1,54 @@
+/**
+ * A benchmark that measures the latency of single 'put' calls of the SeparateChaining class while the table
+ * grows from a few buckets to n key-value pairs (by default 2^22), once with the default resize and once with
+ * the incremental resize. With the default resize, the 'put' calls that trigger a resize rehash the whole
+ * table; with the incremental resize, every 'put' only migrates a few buckets.
+ * Usage: ./resizeBenchmark [n]
+*/
+
+#include "separateChaining.hpp"
+#include <chrono>
+#include <cstdlib>
+
+// returns the i-th key of a pseudo-random sequence of distinct non-negative keys
+int key(int i)
+{
+    return (i * 2654435761u) & 0x7FFFFFFF;
+}
+
+// inserts n keys and prints the total time, the 99.9th percentile and the maximum latency of a 'put'
+void run(int n, bool incrementalResize)
+{
+    SeparateChainingOptions options;
+    options.incrementalResize = incrementalResize;
+
+    SeparateChaining<int, int> table{2, options};
+    vector<double> latencies(n);
+
+    auto begin = chrono::steady_clock::now();
+
+    for (int i = 0; i < n; i++)
+    {
+        auto start = chrono::steady_clock::now();
+        table.put(key(i), i);
+        latencies[i] = chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    }
+
+    chrono::duration<double> total = chrono::steady_clock::now() - begin;
+
+    nth_element(latencies.begin(), latencies.begin() + n / 1000 * 999, latencies.end());
+    double percentile = latencies[n / 1000 * 999];
+    double maximum = *max_element(latencies.begin() + n / 1000 * 999, latencies.end());
+
+    cout << (incrementalResize ? "incremental" : "default    ") << "\t" << total.count() << " s\t\t"
+         << percentile << " us\t\t" << maximum << " us" << endl;
+}
+
+int main(int argc, char *argv[])
+{
+    const int n = argc > 1 ? atoi(argv[1]) : 1 << 22;
+
+    cout << "resize\t\ttotal\t\t\t99.9th percentile\tmaximum" << endl;
+    run(n, false);
+    run(n, true);
+}
\ No newline at end of file
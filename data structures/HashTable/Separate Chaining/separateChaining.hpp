@@ -1,90 +1,343 @@
+#ifndef SEPARATE_CHAINING_HPP
+#define SEPARATE_CHAINING_HPP
+
 
 /**
- * The SeparateChaining class contains the logic to apply modular hashing using separate chaining for 
+ * The SeparateChaining class contains the logic to apply hashing using separate chaining for 
  * collision resolution. Separate chaining is a collision resolution strategy for handling the case
  * when two or more keys to be inserted hash to the same array index. If that happens, they are stored in 
  * the same linked list.
- * Therefore, SeparateChaining has a vector 'hashTable' that stores a list of items of type 'Element'. 
+ * Therefore, SeparateChaining has a vector 'hashTable' that stores the first node of each linked list. The lists
+ * are intrusive: a node holds an item of type 'Element' and a pointer to the next node of the same list. The
+ * nodes come from a slab allocator (see NodePool), and a resize relinks them into the new lists without
+ * allocating or copying them.
  * A hash function which converts keys into array indices is implemented in the 'hashing' method. 
  * The method 'put' is used to insert a key-value pair into the hash table and the method 'removal' is used
  * to delete a key-value pair from the hash table.
  * If we want to know the value of a key, we can use the 'getValue' method.
- * 
+ * The methods 'find', 'tryEmplace' and 'getOrInsert' give access to the stored value with a single scan of
+ * the linked list. All lookups accept any key type the hasher and the key comparison accept, e.g. a
+ * string_view for string keys (see TransparentHash).
+ * The method 'getMany' looks up a batch of keys and prefetches the buckets and the first list nodes of the
+ * following keys, so the cache misses of several lookups overlap instead of being paid one after another.
+ * By default, a resize rehashes the whole table at once. In the incremental resize mode, a resize only
+ * allocates the new bucket array and keeps the old one side by side with it; every later 'put', 'tryEmplace',
+ * 'getOrInsert' and 'removal' then relinks the nodes of a bounded number of old buckets into the new array
+ * (like Redis does), and lookups consult both arrays until the old one is empty.
+ * 'reserve' and 'insertRange' (or the constructor from a range) size the table once for a known number of pairs
+ * instead of growing it step by step. 'insertRange' can insert the pairs of a random access range into an empty
+ * table in parallel: the upper bits of the hash code (the index) split the lists into contiguous parts, one per
+ * thread, and every thread allocates the nodes of its part from a pool of its own and links them. The pool of the
+ * table takes over the slabs of these pools afterwards.
+ * If HASH_TABLE_STATS is defined, the table collects statistics of the lengths of the scanned lists and of its
+ * resizes, which 'statsToJson' exports (see HashTableStats).
 */
 
 #include <vector>
-#include <list>
 #include <iostream>
 #include <functional>
 #include <exception>
-#include "element.hpp"
+#include <utility>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include "../element.hpp"
+#include "nodePool.hpp"
+#include "../transparentHash.hpp"
+#include "../hashTableStats.hpp"
 using namespace std;
 
-template <typename Key, typename Value>
+// the options of a SeparateChaining table; the defaults give a plain table, e.g.
+//     SeparateChainingOptions options;
+//     options.incrementalResize = true;
+//     SeparateChaining<int, int> table{2, options};
+struct SeparateChainingOptions
+{
+    // whether a resize migrates the lists incrementally (see above)
+    bool incrementalResize = false;
+};
+
+template <typename Key, typename Value, typename Hash = TransparentHash<Key>>
 class SeparateChaining
 {
+    // a node of a linked list
+    struct Node
+    {
+        Element<Key, Value> element;
+        Node *next;
+    };
+
     int elements; // holds the number of key-value pairs
-    int size;     // size of the hash table
+    int size;     // size of the hash table (always a power of two)
 
-    // declare our hash table
-    vector<list<Element<Key, Value>>> hashTable;
+    // declare our hash table; it holds the first node of each linked list
+    vector<Node *> hashTable;
+
+    // the nodes of all linked lists
+    NodePool<Node> pool;
 
     // our hasher which we'll use for hashing
-    hash<Key> hasher;
+    Hash hasher;
+
+    // the number of keys 'getMany' prefetches ahead of the key it is resolving
+    static constexpr int prefetchDistance = 8;
+
+    // whether a resize migrates the key-value pairs incrementally
+    bool incrementalResize;
+
+    // the old hash table and its size during an incremental resize (otherwise empty)
+    vector<Node *> oldHashTable;
+    int oldSize;
+
+    // the index of the next bucket of the old hash table to be migrated
+    int migrationIndex;
+
+    // the number of old buckets migrated by each modifying operation; with this step a migration is always
+    // finished before the table has to be resized again
+    static constexpr int migrationStep = 16;
+
+    // the opt-in statistics (empty unless HASH_TABLE_STATS is defined)
+    mutable HashTableStats stats;
+
+    // apply fibonacci hashing for a hash table with 'tableSize' buckets
+    template <typename K>
+    int hashing(const K &key, int tableSize) const
+    {
+        return (static_cast<unsigned long long>(hasher(key)) * 11400714819323198485ull) >> (64 - __builtin_ctz(tableSize));
+    }
+
+    // checks whether an incremental resize is in progress
+    bool isMigrating() const
+    {
+        return !oldHashTable.empty();
+    }
+
+    // returns the node holding the given key in the linked list starting at 'node', or nullptr
+    template <typename K>
+    Node *findNode(Node *node, const K &key) const
+    {
+        int compared = 0;
+
+        while (node != nullptr && node->element.getKey() != key)
+        {
+            node = node->next;
+            compared++;
+        }
+
+        // the number of nodes compared with the key
+        stats.recordProbe(node == nullptr ? compared : compared + 1);
+
+        return node;
+    }
+
+    // relinks all nodes of the linked list starting at 'node' into the lists of hashTable
+    void relink(Node *node)
+    {
+        while (node != nullptr)
+        {
+            Node *next = node->next;
+
+            // the node becomes the first node of the list located at its new hash code
+            Node *&first = hashTable[hashing(node->element.getKey())];
+            node->next = first;
+            first = node;
+
+            node = next;
+        }
+    }
+
+    // moves the lists of the next 'buckets' buckets of the old hash table to the new one
+    void migrate(int buckets)
+    {
+        for (; buckets > 0 && isMigrating(); buckets--)
+        {
+            relink(oldHashTable[migrationIndex]);
+
+            // the old bucket no longer owns its nodes
+            oldHashTable[migrationIndex] = nullptr;
+
+            // the old hash table is released after its last bucket has been migrated
+            if (++migrationIndex == oldSize)
+                vector<Node *>().swap(oldHashTable);
+        }
+    }
 
     // used to resize the hashTable
     void resize(int newSize)
     {
+        auto timer = stats.startResize();
+
+        // a pending incremental resize is finished first
+        migrate(oldSize);
+
+        // keep the current hash table as the old one
+        oldHashTable.swap(hashTable);
+        oldSize = this->size;
+        migrationIndex = 0;
+
         // change the size of the hashTable
         this->size = newSize;
+        hashTable.assign(newSize, nullptr);
+
+        // the lists are migrated by the following operations, or relinked right away
+        if (!incrementalResize)
+            migrate(oldSize);
 
-        // create a temporary hash table
-        vector<list<Element<Key, Value>>> tmp;
+        stats.recordResize(timer);
+    }
 
-        // initialize tmp with empty linked lists
-        tmp.assign(newSize, {});
+    // deletes the first node of the linked list 'first' points to
+    void unlink(Node *&first)
+    {
+        Node *node = first;
+        first = node->next;
+        pool.release(node);
+    }
 
-        // scan through the hashTable
-        for (int i = 0; i < hashTable.size(); i++)
+    // deletes all nodes of the linked list starting at 'node'
+    void clear(Node *node)
+    {
+        while (node != nullptr)
         {
-            // if current linked list is not empty
-            if (!hashTable.at(i).empty())
-            {
-                // then scan through the linked list
-                for (const auto element : hashTable.at(i))
+            Node *next = node->next;
+            pool.release(node);
+            node = next;
+        }
+    }
+
+    // inserts the pairs of a random access range into the empty table with 'threads' threads
+    template <typename Iterator>
+    void parallelInsert(Iterator first, Iterator last, int threads)
+    {
+        int n = last - first;
+
+        // runs 'function(t)' for t = 0, ..., threads - 1 on 'threads' threads and rethrows the first exception
+        auto runParallel = [threads](auto function) {
+            vector<exception_ptr> errors(threads);
+            vector<thread> workers;
+
+            for (int t = 0; t < threads; t++)
+                workers.emplace_back([&, t] {
+                    try
+                    {
+                        function(t);
+                    }
+                    catch (...)
+                    {
+                        errors[t] = current_exception();
+                    }
+                });
+
+            for (thread &worker : workers)
+                worker.join();
+
+            for (exception_ptr &error : errors)
+                if (error)
+                    rethrow_exception(error);
+        };
+
+        // the list of every pair
+        vector<int> homes(n);
+        runParallel([&](int t) {
+            for (int i = static_cast<long>(n) * t / threads; i < static_cast<long>(n) * (t + 1) / threads; i++)
+                homes[i] = hashing((*(first + i)).first);
+        });
+
+        // the list 'home' belongs to the part home * threads / size; the pairs are sorted by the part of their
+        // list (a counting sort, so the order of the pairs of a part is kept)
+        auto partOf = [&](int home) { return static_cast<long>(home) * threads / this->size; };
+
+        vector<int> offsets(threads + 1, 0);
+        for (int home : homes)
+            offsets[partOf(home) + 1]++;
+
+        for (int t = 0; t < threads; t++)
+            offsets[t + 1] += offsets[t];
+
+        vector<int> order(n);
+        vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (int i = 0; i < n; i++)
+            order[next[partOf(homes[i])]++] = i;
+
+        // every thread allocates the nodes of its part from its own pool and links them; a pair whose key is
+        // already in the list updates its value
+        vector<NodePool<Node>> pools(threads);
+        vector<int> inserted(threads, 0);
+        exception_ptr error;
+
+        try
+        {
+            runParallel([&](int t) {
+                for (int j = offsets[t]; j < offsets[t + 1]; j++)
                 {
-                    // determine the hash code
-                    auto hashCode = hashing(element.getKey());
+                    auto &&item = *(first + order[j]);
+                    Node *&head = hashTable[homes[order[j]]];
 
-                    // insert the element in 'tmp'
-                    tmp[hashCode].push_front(element);
-                }
+                    if (Node *existing = findNode(head, item.first))
+                        existing->element.getValue() = forward<decltype(item)>(item).second;
 
-                // clear the linked list
-                hashTable.at(i).clear();
-            }
+                    else
+                    {
+                        head = pools[t].allocate(Element<Key, Value>{forward<decltype(item)>(item).first, forward<decltype(item)>(item).second}, head);
+                        inserted[t]++;
+                    }
+                }
+            });
+        }
+        catch (...)
+        {
+            error = current_exception();
         }
 
-        // now resize the hashTable
-        hashTable.resize(newSize, {});
-
-        // exchange each element of hashTable with those of 'tmp'
-        hashTable.swap(tmp);
+        // the nodes linked so far belong to the table, even if a thread failed
+        for (int t = 0; t < threads; t++)
+        {
+            this->elements += inserted[t];
+            pool.absorb(pools[t]);
+        }
 
-        // clear 'tmp'
-        tmp.clear();
+        if (error)
+            rethrow_exception(error);
     }
 
 public:
     // constructor
-    SeparateChaining(int size) : elements{0}
+    SeparateChaining(int size, Hash hasher = Hash()) : SeparateChaining(size, SeparateChainingOptions{}, hasher) {}
+
+    // constructor with options (see SeparateChainingOptions)
+    SeparateChaining(int size, SeparateChainingOptions options, Hash hasher = Hash())
+        : elements{0}, hasher{hasher}, incrementalResize{options.incrementalResize}, oldSize{0}, migrationIndex{0}
     {
-        // set the size of the hash table
-        this->size = size;
+        // set the size of the hash table to the next power of two
+        this->size = 2;
+        while (this->size < size)
+            this->size *= 2;
 
-        // fill the vector with empty lists
-        for (int i = 0; i < this->size; i++)
-            hashTable.push_back({});
+        // all linked lists are empty
+        hashTable.assign(this->size, nullptr);
+    }
+
+    // constructor that inserts the key-value pairs of a range (see 'insertRange')
+    template <typename Iterator, typename = typename iterator_traits<Iterator>::iterator_category>
+    SeparateChaining(Iterator first, Iterator last, int threads = 1,
+                     SeparateChainingOptions options = SeparateChainingOptions(), Hash hasher = Hash())
+        : SeparateChaining(2, options, hasher)
+    {
+        insertRange(first, last, threads);
+    }
+
+    // the nodes are owned by the table, so it can't be copied
+    SeparateChaining(const SeparateChaining &) = delete;
+    SeparateChaining &operator=(const SeparateChaining &) = delete;
+
+    // destructor
+    ~SeparateChaining()
+    {
+        for (Node *first : hashTable)
+            clear(first);
+
+        for (Node *first : oldHashTable)
+            clear(first);
     }
 
     // returns the size of the hashTable
@@ -99,106 +352,240 @@ public:
         return this->elements;
     }
 
+    // return number of elements in the hash table (under the name the other hash tables use)
+    int getElements() const
+    {
+        return this->elements;
+    }
+
     // check whether hash table is empty
     bool isEmpty() const
     {
         return this->elements == 0 ? true : false;
     }
 
+    // check whether an incremental resize is in progress
+    bool isResizing() const
+    {
+        return isMigrating();
+    }
+
     // define the hash function
-    int hashing(Key key) const
+    template <typename K>
+    int hashing(const K &key) const
     {
-        // apply modular hashing
-        return (hasher(key)) % size;
+        // apply fibonacci hashing: the hash code is multiplied by 2^64 / golden ratio and the upper
+        // log2(size) bits of the product are used as index (instead of the modulo of the hash code)
+        return hashing(key, this->size);
     }
 
-    // checks whether or not the key-value pair is in the hash table
-    bool contains(Key key)
+    // returns a pointer to the value of a key, or nullptr if the key-value pair is not in the hash table
+    template <typename K>
+    Value *find(const K &key)
     {
-        // determine the hash code so that we know where to look at
-        auto hashCode = hashing(key);
+        // scan through the linked list located at the hash code of the key
+        Node *node = findNode(hashTable[hashing(key)], key);
 
-        // start at the beginning of the linked list
-        auto iter = hashTable.at(hashCode).begin();
+        // during an incremental resize the key might still be in the old hash table
+        if (node == nullptr && isMigrating())
+            node = findNode(oldHashTable[hashing(key, oldSize)], key);
 
-        // scan through the linked list
-        while (iter != hashTable.at(hashCode).end())
-        {
-            // is key already in the hash table ? if yes, return true
-            if ((*iter).getKey() == key)
-                return true;
+        return node == nullptr ? nullptr : &node->element.getValue();
+    }
 
-            // go to next element
-            iter++;
-        }
+    template <typename K>
+    const Value *find(const K &key) const
+    {
+        return const_cast<SeparateChaining *>(this)->find(key);
+    }
 
-        // otherwise return false
-        return false;
+    // checks whether or not the key-value pair is in the hash table
+    template <typename K>
+    bool contains(const K &key) const
+    {
+        return find(key) != nullptr;
     }
 
     // returns the value of a key
-    Value getValue(Key key)
+    template <typename K>
+    Value getValue(const K &key) const
     {
-        // check if key is in the hash table
-        if (!contains(key))
-            throw runtime_error{"No value: key-value pair does not exist."};
-
-        // determine the hash code
-        auto hashCode = hashing(key);
-
-        // start at the begining of the linked list
-        auto iter = hashTable.at(hashCode).begin();
-
-        // search the key-value pair within the linked list at 'hashCode' in hashTable
-        while (iter != hashTable.at(hashCode).end())
-        {
-            // key-value pair is found
-            if ((*iter).getKey() == key)
-                break;
-
-            // go to next element
-            iter++;
-        }
+        const Value *value = find(key);
 
         // if key is not found, throw an exception
-        if (iter == hashTable.at(hashCode).end())
+        if (value == nullptr)
             throw runtime_error{"No value: key-value pair does not exist."};
 
         // otherwise, return the value
-        return (*iter).getValue();
+        return *value;
     }
 
-    void put(Key key, Value value)
+    // inserts a key with a value constructed from 'args' if the key does not exist yet
+    // returns a pointer to the value of the key and whether the key was inserted; 'args' are only used
+    // when the key is inserted
+    template <typename... Args>
+    pair<Value *, bool> tryEmplace(Key key, Args &&...args)
     {
+        // do a step of a pending incremental resize
+        migrate(migrationStep);
+
+        // if key already in the hash table, return its value
+        if (Value *value = find(key))
+            return {value, false};
+
         // guarantees that the hash table is at most one-half full
         if (this->elements >= this->size / 2)
             resize(2 * this->size);
 
-        // determine the hash code
-        auto hashCode = hashing(key);
-
-        // create the new key-value pair
-        auto keyValuePair = Element<Key, Value>{key, value};
-
-        // add the key-value pair to the linked list located at 'hashCode' in hashTable
-        hashTable.at(hashCode).push_front(keyValuePair);
+        // add the key-value pair to the front of the linked list located at 'hashCode' in hashTable
+        Node *&first = hashTable[hashing(key)];
+        first = pool.allocate(Element<Key, Value>{move(key), Value(forward<Args>(args)...)}, first);
 
         // increment nr. of key-value pairs
         this->elements++;
+
+        return {&first->element.getValue(), true};
+    }
+
+    // returns a reference to the value of a key; a default value is inserted if the key does not exist
+    Value &getOrInsert(Key key)
+    {
+        return *tryEmplace(move(key)).first;
+    }
+
+    void put(Key key, Value value)
+    {
+        auto [slot, inserted] = tryEmplace(move(key), move(value));
+
+        // if key already in the hash table, update its value
+        // (the value is only moved by 'tryEmplace' if the key was inserted)
+        if (!inserted)
+            *slot = move(value);
+    }
+
+    // makes room for 'n' key-value pairs, so they can be inserted without a resize
+    void reserve(int n)
+    {
+        // a 'put' resizes when the hash table is one-half full
+        int newSize = this->size;
+        while (newSize / 2 < n)
+            newSize *= 2;
+
+        if (newSize > this->size)
+        {
+            // the nodes are relinked right away, even in the incremental resize mode
+            resize(newSize);
+            migrate(oldSize);
+        }
+    }
+
+    // puts the key-value pairs of a range (e.g. of a vector<pair<Key, Value>>; with move iterators the pairs
+    // are moved) into the hash table; if a key occurs more than once, its last value wins
+    // the table is sized once for the pairs of a forward range; the pairs of a random access range are inserted
+    // with 'threads' threads if the table is empty
+    template <typename Iterator>
+    void insertRange(Iterator first, Iterator last, int threads = 1)
+    {
+        using Category = typename iterator_traits<Iterator>::iterator_category;
+
+        if constexpr (is_base_of_v<forward_iterator_tag, Category>)
+            reserve(this->elements + distance(first, last));
+
+        if constexpr (is_base_of_v<random_access_iterator_tag, Category>)
+            if (threads > 1 && this->elements == 0 && !isMigrating())
+            {
+                parallelInsert(first, last, threads);
+                return;
+            }
+
+        for (; first != last; ++first)
+        {
+            auto &&item = *first;
+            put(forward<decltype(item)>(item).first, forward<decltype(item)>(item).second);
+        }
+    }
+
+    // used to look up a batch of keys: 'found[i]' tells whether 'keys[i]' exists and, if so, 'values[i]'
+    // holds its value
+    // the first node of a list can only be located after its bucket has been loaded, so prefetching has two
+    // stages: while the key at position i is resolved, the key at position i + 2 * prefetchDistance is hashed
+    // and its bucket is prefetched, and the first node of the key at position i + prefetchDistance (whose
+    // bucket was prefetched before) is prefetched
+    template <typename K>
+    void getMany(const vector<K> &keys, vector<Value> &values, vector<bool> &found) const
+    {
+        const int distance = 2 * prefetchDistance;
+
+        int n = keys.size();
+        values.resize(n);
+        found.assign(n, false);
+
+        // the indices of the keys at positions i, ..., i + distance - 1 (a ring buffer)
+        int indices[distance];
+
+        for (int i = -distance; i < n; i++)
+        {
+            // the index of the key at position i (its entry in the ring buffer is reused below)
+            int index = i >= 0 ? indices[i % distance] : 0;
+
+            // first stage: hash the key and prefetch its bucket
+            if (i + distance < n)
+            {
+                indices[(i + distance) % distance] = hashing(keys[i + distance]);
+                __builtin_prefetch(&hashTable[indices[(i + distance) % distance]]);
+            }
+
+            // second stage: prefetch the first node of the bucket
+            if (i + prefetchDistance >= 0 && i + prefetchDistance < n)
+                if (const Node *first = hashTable[indices[(i + prefetchDistance) % distance]])
+                    __builtin_prefetch(first);
+
+            if (i < 0)
+                continue;
+
+            // scan through the linked list located at the hash code of the key
+            const Node *node = findNode(hashTable[index], keys[i]);
+            if (node != nullptr)
+            {
+                values[i] = node->element.getValue();
+                found[i] = true;
+            }
+
+            // during an incremental resize the key might still be in the old hash table
+            else if (isMigrating())
+                if (const Node *old = findNode(oldHashTable[hashing(keys[i], oldSize)], keys[i]))
+                {
+                    values[i] = old->element.getValue();
+                    found[i] = true;
+                }
+        }
     }
 
     // used to delete a key-value pair
-    void removal(Key key)
+    template <typename K>
+    void removal(const K &key)
     {
+        // do a step of a pending incremental resize
+        migrate(migrationStep);
+
+        // find the link pointing to the node to be deleted in the linked list located at the hash code
+        Node **link = &hashTable[hashing(key)];
+        while (*link != nullptr && (*link)->element.getKey() != key)
+            link = &(*link)->next;
+
+        // during an incremental resize the key might still be in the old hash table
+        if (*link == nullptr && isMigrating())
+        {
+            link = &oldHashTable[hashing(key, oldSize)];
+            while (*link != nullptr && (*link)->element.getKey() != key)
+                link = &(*link)->next;
+        }
+
         // check whether key exists
-        if (!contains(key))
+        if (*link == nullptr)
             throw runtime_error{"Removal failed: Key does not exist."};
 
-        // determine the hash code
-        auto hashCode = hashing(key);
-
-        // remove if key of element equals given key
-        hashTable.at(hashCode).remove_if([key](Element<Key, Value> element) { return element.getKey() == key; });
+        unlink(*link);
 
         // decrement nr of key-value pairs
         this->elements--;
@@ -208,17 +595,74 @@ public:
             resize(this->size / 2);
     }
 
+    // calls 'function(key, value)' for every key-value pair, in no particular order
+    template <typename Function>
+    void forEach(Function function) const
+    {
+        for (const vector<Node *> *table : {&hashTable, &oldHashTable})
+            for (const Node *node : *table)
+                for (; node != nullptr; node = node->next)
+                    function(node->element.getKey(), node->element.getValue());
+    }
+
+#ifdef HASH_TABLE_STATS
+    // returns the statistics of the list lengths and resizes
+    const HashTableStats &getStats() const
+    {
+        return stats;
+    }
+
+    // resets the statistics
+    void resetStats()
+    {
+        stats.reset();
+    }
+
+    // exports the statistics as JSON; besides the counters, the table is scanned for the length of every list
+    // (including the empty ones and the lists of the old hash table which are not migrated yet)
+    string statsToJson() const
+    {
+        LengthHistogram chains;
+        int lists = this->size + (isMigrating() ? oldSize - migrationIndex : 0);
+
+        for (int index = 0; index < lists; index++)
+        {
+            int length = 0;
+            for (Node *node = index < this->size ? hashTable[index] : oldHashTable[migrationIndex + index - this->size]; node != nullptr; node = node->next)
+                length++;
+
+            chains.add(length);
+        }
+
+        // there are no tombstones in a chained table
+        return stats.toJson(this->elements, lists, 0, "chainLengths", chains);
+    }
+#endif
+
     // print hashTable content (just for debugging purposes)
     void printHashTable()
     {
-        int index = 0;
-        for (const auto list : hashTable)
+        for (int index = 0; index < this->size; index++)
         {
             cout << "List " << index << ": ";
-            for (const auto element : list)
-                cout << "(" << element.getKey() << "," << element.getValue() << ") ";
+            for (Node *node = hashTable[index]; node != nullptr; node = node->next)
+                cout << "(" << node->element.getKey() << "," << node->element.getValue() << ") ";
             cout << endl;
-            index++;
+        }
+
+        // the old hash table during an incremental resize
+        if (isMigrating())
+        {
+            cout << "Old hash table (migrated up to list " << migrationIndex << "):" << endl;
+            for (int index = migrationIndex; index < oldSize; index++)
+            {
+                cout << "List " << index << ": ";
+                for (Node *node = oldHashTable[index]; node != nullptr; node = node->next)
+                    cout << "(" << node->element.getKey() << "," << node->element.getValue() << ") ";
+                cout << endl;
+            }
         }
     }
 };
+
+#endif
@@ -0,0 +1,58 @@
+
+/**
+ * The client that tests the functionalities of the SwissTable class and compares its lookups with those
+ * of the LinearProbing class.
+*/
+
+#include "swissTable.hpp"
+#include "../Linear Probing/linearProbing.hpp"
+#include <string>
+#include <chrono>
+
+int main()
+{
+    SwissTable<string, int> st;
+    st.put("Abdullah", 33);
+    st.put("Abdullah", 36);
+
+    cout << "The value of key Abdullah is " << st.getValue("Abdullah") << endl;
+
+    auto keyToSearch = "Abdullah";
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << st.contains(keyToSearch) << endl;
+
+    st.put("Arif", 28);
+    st.put("Günther", 55);
+    st.put("Klaus", 48);
+    st.removal("Abdullah");
+
+    cout << "Does the key " << keyToSearch << " exist? Answer: " << boolalpha << st.contains(keyToSearch) << endl;
+    cout << "How many elements do we have in the hash table? Answer: " << st.getElements() << endl;
+
+    // compare the lookups with linear probing
+    const int n = 2000000;
+    vector<string> keys;
+    for (int i = 0; i < n; i++)
+        keys.push_back("key-" + to_string(i));
+
+    SwissTable<string, int> swissTable;
+    LinearProbing<string, int> linearProbing{4 * n};
+    for (int i = 0; i < n; i++)
+    {
+        swissTable.put(keys[i], i);
+        linearProbing.put(keys[i], i);
+    }
+
+    auto start = chrono::steady_clock::now();
+    long sum = 0;
+    for (int i = 0; i < n; i++)
+        sum += swissTable.getValue(keys[(i * 7919LL) % n]);
+    chrono::duration<double> swissTime = chrono::steady_clock::now() - start;
+
+    start = chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        sum -= linearProbing.getValue(keys[(i * 7919LL) % n]);
+    chrono::duration<double> linearTime = chrono::steady_clock::now() - start;
+
+    cout << "Lookups of " << n << " keys: SwissTable " << swissTime.count() << " s, LinearProbing "
+         << linearTime.count() << " s (checksum " << sum << ")" << endl;
+}
\ No newline at end of file
@@ -0,0 +1,326 @@
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+using namespace std;
+
+/**
+ * The SwissTable class implements an open addressing hash table in the style of Google's Swiss table.
+ * Besides the slots holding the key-value pairs inline, the table keeps a separate array of 1-byte control
+ * bytes, one per slot: a control byte is either 'empty', 'deleted' or, for an occupied slot, the lower 7 bits
+ * of the hash code of its key (h2). The remaining bits of the hash code (h1) select where the probing starts.
+ * The slots are organized in groups of 16. Probing visits whole groups: the 16 control bytes of a group are
+ * compared with h2 at once (with SSE2 instructions if available), and only the slots whose control byte
+ * matches are compared with the full key. The probing stops at the first group that contains an empty slot.
+ * So, a lookup usually touches one cache line of control bytes and one cache line of slots.
+ * The table grows when it is 7/8 full (including deleted slots).
+*/
+
+template <typename Key, typename Value>
+class SwissTable
+{
+    // holds the number of slots in a group
+    static constexpr int groupSize = 16;
+
+    // control byte of an empty slot
+    static constexpr int8_t emptyControl = -128;
+
+    // control byte of a deleted slot (a tombstone)
+    static constexpr int8_t deletedControl = -2;
+
+    // a key-value pair stored inline in a slot
+    using Slot = pair<Key, Value>;
+
+    // holds the number of key-value pairs
+    int elements;
+
+    // holds the number of deleted slots
+    int deleted;
+
+    // holds the number of slots (a power of two and a multiple of the group size)
+    int capacity;
+
+    // the control bytes, one per slot
+    unique_ptr<int8_t[]> control;
+
+    // the slots; only the slots with a non-negative control byte hold a constructed key-value pair
+    Slot *slots;
+
+    // our hasher which we'll use for hashing
+    hash<Key> hasher;
+
+    // method that returns a bit mask of the slots in the group starting at 'first' whose control byte equals 'h2'
+    unsigned int match(int first, int8_t h2) const
+    {
+#ifdef __SSE2__
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&control[first]));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(h2)));
+#else
+        unsigned int mask = 0;
+        for (int i = 0; i < groupSize; i++)
+            mask |= static_cast<unsigned int>(control[first + i] == h2) << i;
+        return mask;
+#endif
+    }
+
+    // method that returns a bit mask of the empty or deleted slots in the group starting at 'first'
+    // (exactly the slots whose control byte has the sign bit set)
+    unsigned int matchEmptyOrDeleted(int first) const
+    {
+#ifdef __SSE2__
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&control[first]));
+        return _mm_movemask_epi8(group);
+#else
+        unsigned int mask = 0;
+        for (int i = 0; i < groupSize; i++)
+            mask |= static_cast<unsigned int>(control[first + i] < 0) << i;
+        return mask;
+#endif
+    }
+
+    // method that computes the mixed hash code of a key
+    size_t hashing(const Key &key) const
+    {
+        // fibonacci hashing spreads the bits of weak hash codes (e.g. identity hashes of integers)
+        size_t h = hasher(key) * 11400714819323198485ull;
+        return h ^ (h >> 29);
+    }
+
+    // method that returns the first group to probe for the given hash code
+    int firstGroup(size_t h) const
+    {
+        return (h >> 7) & (capacity / groupSize - 1);
+    }
+
+    // method that returns the index of the slot holding the given key, or -1
+    int find(const Key &key) const
+    {
+        size_t h = hashing(key);
+        int8_t h2 = h & 0x7F;
+        int groups = capacity / groupSize;
+
+        // quadratic probing over the groups: g, g + 1, g + 3, g + 6, ... visits every group
+        int group = firstGroup(h);
+        for (int step = 1; step <= groups; step++)
+        {
+            int first = group * groupSize;
+
+            // compare the full key only for the slots whose control byte matches
+            for (unsigned int mask = match(first, h2); mask != 0; mask &= mask - 1)
+            {
+                int i = first + __builtin_ctz(mask);
+                if (slots[i].first == key)
+                    return i;
+            }
+
+            // a group with an empty slot ends the probing
+            if (match(first, emptyControl) != 0)
+                return -1;
+
+            group = (group + step) & (groups - 1);
+        }
+
+        return -1;
+    }
+
+    // method that returns the index of the first empty or deleted slot along the probe sequence of 'h'
+    int findInsertSlot(size_t h) const
+    {
+        int groups = capacity / groupSize;
+
+        int group = firstGroup(h);
+        for (int step = 1;; step++)
+        {
+            int first = group * groupSize;
+
+            unsigned int mask = matchEmptyOrDeleted(first);
+            if (mask != 0)
+                return first + __builtin_ctz(mask);
+
+            group = (group + step) & (groups - 1);
+        }
+    }
+
+    // method to allocate empty control bytes and slots for 'newCapacity' slots
+    void allocate(int newCapacity)
+    {
+        capacity = newCapacity;
+        control.reset(new int8_t[capacity]);
+        fill(control.get(), control.get() + capacity, emptyControl);
+        slots = allocator<Slot>{}.allocate(capacity);
+    }
+
+    // method to destroy all key-value pairs and free the slots
+    void deallocate()
+    {
+        for (int i = 0; i < capacity; i++)
+            if (control[i] >= 0)
+                slots[i].~Slot();
+
+        allocator<Slot>{}.deallocate(slots, capacity);
+    }
+
+    // used to rebuild the table with 'newCapacity' slots; this also drops all tombstones
+    void resize(int newCapacity)
+    {
+        unique_ptr<int8_t[]> oldControl = move(control);
+        Slot *oldSlots = slots;
+        int oldCapacity = capacity;
+
+        allocate(newCapacity);
+
+        // move every key-value pair into the new table
+        for (int i = 0; i < oldCapacity; i++)
+        {
+            if (oldControl[i] < 0)
+                continue;
+
+            size_t h = hashing(oldSlots[i].first);
+            int j = findInsertSlot(h);
+
+            control[j] = h & 0x7F;
+            new (&slots[j]) Slot{move(oldSlots[i])};
+            oldSlots[i].~Slot();
+        }
+
+        allocator<Slot>{}.deallocate(oldSlots, oldCapacity);
+        deleted = 0;
+    }
+
+public:
+    // constructor
+    SwissTable(int size = groupSize) : elements{0}, deleted{0}
+    {
+        // the capacity is the next power of two, at least one group
+        int newCapacity = groupSize;
+        while (newCapacity < size)
+            newCapacity *= 2;
+
+        allocate(newCapacity);
+    }
+
+    // the slots are owned by the table, so it can't be copied
+    SwissTable(const SwissTable &) = delete;
+    SwissTable &operator=(const SwissTable &) = delete;
+
+    // destructor
+    ~SwissTable()
+    {
+        deallocate();
+    }
+
+    // used to get the number of key-value pairs in the hash table
+    int getElements() const
+    {
+        return this->elements;
+    }
+
+    // used to get the number of slots
+    int getCapacity() const
+    {
+        return this->capacity;
+    }
+
+    // check if hash table is empty
+    bool isEmpty() const
+    {
+        return this->elements == 0;
+    }
+
+    // used to check if hashtable contains a given key
+    bool contains(const Key &key) const
+    {
+        return find(key) != -1;
+    }
+
+    // puts a key-value pair into the hash table
+    void put(Key key, Value value)
+    {
+        // if key already in hashTable, update its value
+        int i = find(key);
+        if (i != -1)
+        {
+            slots[i].second = move(value);
+            return;
+        }
+
+        // guarantees that the hash table is at most 7/8 full; if most of the used slots are tombstones,
+        // the table is rebuilt with the same capacity
+        if (this->elements + this->deleted + 1 > this->capacity / 8 * 7)
+            resize(this->elements + 1 > this->capacity / 16 * 7 ? 2 * this->capacity : this->capacity);
+
+        size_t h = hashing(key);
+        i = findInsertSlot(h);
+
+        if (control[i] == deletedControl)
+            this->deleted--;
+
+        control[i] = h & 0x7F;
+        new (&slots[i]) Slot{move(key), move(value)};
+
+        // increment nr. of elements
+        this->elements++;
+    }
+
+    // used to delete a key-value pair
+    void removal(const Key &key)
+    {
+        int i = find(key);
+
+        // no need to remove, when key does not exist
+        if (i == -1)
+            return;
+
+        slots[i].~Slot();
+
+        // if the group still has an empty slot, it has never been full, so no probe sequence ever went
+        // past it and the slot can become empty again; otherwise a tombstone keeps the probe sequences intact
+        int first = i / groupSize * groupSize;
+        if (match(first, emptyControl) != 0)
+            control[i] = emptyControl;
+        else
+        {
+            control[i] = deletedControl;
+            this->deleted++;
+        }
+
+        // decrement the nr of key-value pairs
+        this->elements--;
+    }
+
+    // used to get the value of a given key
+    Value getValue(const Key &key) const
+    {
+        int i = find(key);
+
+        // if key-value pair is not in hashTable, an exception is thrown
+        if (i == -1)
+            throw runtime_error{"No value: key-value pair not exists."};
+
+        return slots[i].second;
+    }
+
+    // used to print the hash table content (only for debugging purposes)
+    void printHashTable()
+    {
+        for (int i = 0; i < this->capacity; i++)
+        {
+            cout << "Index " << i << ": ";
+            if (control[i] >= 0)
+                cout << "(" << slots[i].first << "," << slots[i].second << ")" << endl;
+
+            else if (control[i] == deletedControl)
+                cout << "deleted" << endl;
+
+            else
+                cout << "unoccupied" << endl;
+        }
+    }
+};
\ No newline at end of file
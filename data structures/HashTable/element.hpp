@@ -0,0 +1,41 @@
+/**
+ * The struct 'Element' represents a key-value pair which we will use in the LinearProbing class
+ * (inline within the hash table) and in the SeparateChaining class (within the list nodes).
+*/
+
+#ifndef HASH_TABLE_ELEMENT_HPP
+#define HASH_TABLE_ELEMENT_HPP
+
+#include <utility>
+
+template <typename Key, typename Value>
+struct Element
+{
+    Element(Key key, Value value) : key{std::move(key)}, value{std::move(value)} {}
+
+    const Key &getKey() const
+    {
+        return this->key;
+    }
+
+    const Value &getValue() const
+    {
+        return this->value;
+    }
+
+    Value &getValue()
+    {
+        return this->value;
+    }
+
+    void setValue(Value newValue)
+    {
+        this->value = std::move(newValue);
+    }
+
+private:
+    Key key;
+    Value value;
+};
+
+#endif
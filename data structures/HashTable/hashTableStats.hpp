@@ -0,0 +1,197 @@
+#ifndef HASH_TABLE_STATS_HPP
+#define HASH_TABLE_STATS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+/**
+ * The opt-in statistics of the LinearProbing and SeparateChaining classes.
+ * If HASH_TABLE_STATS is defined (e.g. compile with -DHASH_TABLE_STATS), a table counts the probe lengths of
+ * its lookups and insertions (the number of slots examined, or the number of list nodes compared) in a
+ * histogram, and measures the number and duration of its resizes. The method 'statsToJson' of the table exports
+ * these counters together with a snapshot of the table (its load factor, tombstones and the probe lengths of
+ * all stored pairs, or the lengths of all lists) as JSON.
+ * Otherwise, HashTableStats is an empty class whose methods do nothing, so the compiler removes the counting
+ * and the tables are exactly as fast as without statistics.
+ * The counters are relaxed atomics, so lookups running concurrently under a shared lock (see ConcurrentMap)
+ * can count their probe lengths without a data race.
+*/
+
+// a histogram of lengths; the lengths >= bins - 1 share the last bin
+struct LengthHistogram
+{
+    static constexpr int bins = 64;
+
+    std::atomic<long> counts[bins] = {};
+    std::atomic<long> total{0};
+    std::atomic<long> sum{0};
+    std::atomic<int> max{0};
+
+    // used to count a length
+    void add(int length)
+    {
+        counts[length < bins - 1 ? length : bins - 1].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(length, std::memory_order_relaxed);
+
+        int current = max.load(std::memory_order_relaxed);
+        while (length > current && !max.compare_exchange_weak(current, length, std::memory_order_relaxed))
+            ;
+    }
+
+    // used to get the average length
+    double average() const
+    {
+        long n = total.load(std::memory_order_relaxed);
+        return n == 0 ? 0 : static_cast<double>(sum.load(std::memory_order_relaxed)) / n;
+    }
+
+    // used to forget all lengths
+    void reset()
+    {
+        for (auto &count : counts)
+            count.store(0, std::memory_order_relaxed);
+
+        total.store(0, std::memory_order_relaxed);
+        sum.store(0, std::memory_order_relaxed);
+        max.store(0, std::memory_order_relaxed);
+    }
+
+    // used to export the histogram as a JSON object; the bins after the last non-empty bin are omitted
+    std::string toJson() const
+    {
+        int last = bins - 1;
+        while (last >= 0 && counts[last].load(std::memory_order_relaxed) == 0)
+            last--;
+
+        std::ostringstream json;
+        json << "{\"count\": " << total.load(std::memory_order_relaxed) << ", \"average\": " << average()
+             << ", \"max\": " << max.load(std::memory_order_relaxed) << ", \"histogram\": [";
+
+        for (int i = 0; i <= last; i++)
+            json << (i > 0 ? ", " : "") << counts[i].load(std::memory_order_relaxed);
+
+        json << "]}";
+        return json.str();
+    }
+};
+
+#ifdef HASH_TABLE_STATS
+
+class HashTableStats
+{
+    // the probe lengths of the lookups and insertions
+    LengthHistogram probes;
+
+    // the number of resizes and their total and maximum duration
+    std::atomic<long> resizes{0};
+    std::atomic<double> resizeSeconds{0};
+    std::atomic<double> maxResizeSeconds{0};
+
+public:
+    // the start time of a resize
+    using Timer = std::chrono::steady_clock::time_point;
+
+    // used to count the probe length of a lookup or an insertion
+    void recordProbe(int length)
+    {
+        probes.add(length);
+    }
+
+    // used to start measuring a resize
+    Timer startResize() const
+    {
+        return std::chrono::steady_clock::now();
+    }
+
+    // used to count a resize which started at 'start'
+    void recordResize(Timer start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        resizes.fetch_add(1, std::memory_order_relaxed);
+        resizeSeconds.store(resizeSeconds.load(std::memory_order_relaxed) + elapsed.count(), std::memory_order_relaxed);
+
+        if (elapsed.count() > maxResizeSeconds.load(std::memory_order_relaxed))
+            maxResizeSeconds.store(elapsed.count(), std::memory_order_relaxed);
+    }
+
+    // used to get the histogram of the probe lengths
+    const LengthHistogram &getProbes() const
+    {
+        return probes;
+    }
+
+    // used to get the number of resizes
+    long getResizes() const
+    {
+        return resizes.load(std::memory_order_relaxed);
+    }
+
+    // used to get the total duration of the resizes in seconds
+    double getResizeSeconds() const
+    {
+        return resizeSeconds.load(std::memory_order_relaxed);
+    }
+
+    // used to get the duration of the slowest resize in seconds
+    double getMaxResizeSeconds() const
+    {
+        return maxResizeSeconds.load(std::memory_order_relaxed);
+    }
+
+    // used to reset all counters
+    void reset()
+    {
+        probes.reset();
+        resizes.store(0, std::memory_order_relaxed);
+        resizeSeconds.store(0, std::memory_order_relaxed);
+        maxResizeSeconds.store(0, std::memory_order_relaxed);
+    }
+
+    // used to export the counters and a snapshot of a table as a JSON object: 'slots' is the number of slots
+    // (or lists), 'tombstones' the number of slots marked as deleted and 'layout' the histogram named
+    // 'layoutName' computed from the stored pairs
+    std::string toJson(int elements, int slots, int tombstones, const std::string &layoutName, const LengthHistogram &layout) const
+    {
+        std::ostringstream json;
+        json << "{\"elements\": " << elements
+             << ", \"slots\": " << slots
+             << ", \"loadFactor\": " << (slots == 0 ? 0 : static_cast<double>(elements) / slots)
+             << ", \"tombstones\": " << tombstones
+             << ", \"tombstoneRatio\": " << (slots == 0 ? 0 : static_cast<double>(tombstones) / slots)
+             << ", \"resizes\": " << getResizes()
+             << ", \"resizeSeconds\": " << getResizeSeconds()
+             << ", \"maxResizeSeconds\": " << getMaxResizeSeconds()
+             << ", \"probes\": " << probes.toJson()
+             << ", \"" << layoutName << "\": " << layout.toJson() << "}";
+
+        return json.str();
+    }
+};
+
+#else
+
+// the statistics are disabled: nothing is counted
+class HashTableStats
+{
+public:
+    struct Timer
+    {
+    };
+
+    void recordProbe(int) {}
+
+    Timer startResize() const
+    {
+        return {};
+    }
+
+    void recordResize(Timer) {}
+};
+
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef TRANSPARENT_HASH_HPP
+#define TRANSPARENT_HASH_HPP
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+/**
+ * The default hasher of the hash tables. For most key types it is just 'std::hash<Key>'.
+ * For string keys it is transparent: it hashes a string, a string_view or a C string through 'std::string_view'
+ * without constructing a string, and all of them get the same hash code. So, a hash table with string keys can
+ * be searched with a string_view.
+*/
+
+template <typename Key>
+struct TransparentHash : std::hash<Key>
+{
+};
+
+template <>
+struct TransparentHash<std::string>
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view key) const
+    {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,325 @@
+#ifndef ADDRESSABLE_HEAP_HPP
+#define ADDRESSABLE_HEAP_HPP
+
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * An addressable binary heap parameterized by a comparator (see Heap in heap.hpp).
+ * Every inserted item gets a stable handle which stays valid until the item is deleted. The heap maintains
+ * a position map (handle -> position in the heap), so an item can be removed or updated through its handle
+ * in O(log n) and 'contains' is answered in O(1) without searching the heap array.
+ * The slots of deleted items are reused by later insertions. Every slot has a generation which is incremented
+ * when its item is deleted, so a handle kept after its item was deleted is rejected instead of referring to the
+ * item which reused the slot.
+*/
+
+// a handle of an item in an AddressableHeap; a handle becomes invalid after its item was deleted
+struct HeapHandle
+{
+    int index;
+    unsigned int generation;
+};
+
+template <typename Item, typename Compare = less<Item>>
+class AddressableHeap
+{
+    // the heap array
+    vector<Item> pq;
+
+    // position in the heap -> handle of the item at that position
+    vector<int> handles;
+
+    // handle -> position of its item in the heap (or -1 if the handle is not in use)
+    vector<int> position;
+
+    // handle -> generation of the handle (incremented when its item is deleted)
+    vector<unsigned int> generations;
+
+    // handles of deleted items that can be reused
+    vector<int> freeHandles;
+
+    // the comparator used to order the items
+    Compare compare;
+
+    // method that computes the index of the left child of item at 'idx'
+    int getLeftChildIndex(int idx)
+    {
+        return 2 * idx + 1;
+    }
+
+    // method that computes the index of the parent of item at 'idx'
+    int getParentIndex(int idx)
+    {
+        return (idx - 1) / 2;
+    }
+
+    // method to move the item at 'from' to 'to' and keep the position map up to date
+    void moveItem(int from, int to)
+    {
+        pq[to] = move(pq[from]);
+        handles[to] = handles[from];
+        position[handles[to]] = to;
+    }
+
+    // method that applies bottom-up heapify to restore the heap condition
+    void bottomUpHeapify(int curIndex)
+    {
+        // take the item and its handle out of the heap
+        Item item = move(pq[curIndex]);
+        int handle = handles[curIndex];
+
+        while (curIndex > 0)
+        {
+            int parentIndex = getParentIndex(curIndex);
+
+            if (!compare(item, pq[parentIndex]))
+                break;
+
+            // move the parent down into the hole
+            moveItem(parentIndex, curIndex);
+
+            curIndex = parentIndex;
+        }
+
+        // put the item into the hole
+        pq[curIndex] = move(item);
+        handles[curIndex] = handle;
+        position[handle] = curIndex;
+    }
+
+    // method that applies top-down heapify to restore the heap condition
+    void topDownHeapify(int curIndex)
+    {
+        int items = pq.size();
+
+        // take the item and its handle out of the heap
+        Item item = move(pq[curIndex]);
+        int handle = handles[curIndex];
+
+        while (true)
+        {
+            int childIndex = getLeftChildIndex(curIndex);
+
+            if (childIndex >= items)
+                break;
+
+            // select the right child if it has to be on top of the left child
+            if (childIndex + 1 < items && compare(pq[childIndex + 1], pq[childIndex]))
+                childIndex++;
+
+            if (!compare(pq[childIndex], item))
+                break;
+
+            // move the child up into the hole
+            moveItem(childIndex, curIndex);
+
+            curIndex = childIndex;
+        }
+
+        // put the item into the hole
+        pq[curIndex] = move(item);
+        handles[curIndex] = handle;
+        position[handle] = curIndex;
+    }
+
+    // method to restore the heap condition after the item at 'pos' was replaced
+    void restore(int pos)
+    {
+        if (pos > 0 && compare(pq[pos], pq[getParentIndex(pos)]))
+            bottomUpHeapify(pos);
+        else
+            topDownHeapify(pos);
+    }
+
+    // method that returns an unused handle
+    int acquireHandle()
+    {
+        if (!freeHandles.empty())
+        {
+            int handle = freeHandles.back();
+            freeHandles.pop_back();
+            return handle;
+        }
+
+        position.push_back(-1);
+        generations.push_back(0);
+        return position.size() - 1;
+    }
+
+    // method that throws if the handle does not refer to an item in the heap
+    void checkHandle(HeapHandle handle) const
+    {
+        if (!contains(handle))
+            throw invalid_argument{"Invalid argument: handle is not in the PQ."};
+    }
+
+    // method to delete the item at position 'pos' and release its handle
+    void removeAt(int pos)
+    {
+        int handle = handles[pos];
+        int last = pq.size() - 1;
+
+        // move the last item into the position of the removed one
+        if (pos != last)
+            moveItem(last, pos);
+
+        pq.pop_back();
+        handles.pop_back();
+
+        // release the handle; the new generation invalidates the handles given out for it so far
+        position[handle] = -1;
+        generations[handle]++;
+        freeHandles.push_back(handle);
+
+        // the moved item might have to go up or down
+        if (pos != last)
+            restore(pos);
+    }
+
+public:
+    // constructor; 'initialCapacity' is only a hint since the heap grows on demand
+    AddressableHeap(int initialCapacity = 0, Compare compare = Compare()) : compare{compare}
+    {
+        if (initialCapacity < 0)
+            throw invalid_argument{"Invalid argument: initial capacity < 0."};
+
+        pq.reserve(initialCapacity);
+        handles.reserve(initialCapacity);
+        position.reserve(initialCapacity);
+        generations.reserve(initialCapacity);
+    }
+
+    // method to get the number of items in the heap
+    int getSize() const
+    {
+        return pq.size();
+    }
+
+    // method to check if the heap is empty
+    bool isEmpty() const
+    {
+        return pq.empty();
+    }
+
+    // method to insert an item into the heap; returns the handle of the item
+    HeapHandle insert(Item newItem)
+    {
+        int handle = acquireHandle();
+
+        // insert the new item at the end of the heap
+        pq.push_back(move(newItem));
+        handles.push_back(handle);
+        position[handle] = pq.size() - 1;
+
+        // apply bottom-up heapify to restore the heap condition
+        bottomUpHeapify(pq.size() - 1);
+
+        return HeapHandle{handle, generations[handle]};
+    }
+
+    // method to construct an item in place and insert it into the heap; returns the handle of the item
+    template <typename... Args>
+    HeapHandle emplace(Args &&...args)
+    {
+        int handle = acquireHandle();
+
+        pq.emplace_back(forward<Args>(args)...);
+        handles.push_back(handle);
+        position[handle] = pq.size() - 1;
+
+        bottomUpHeapify(pq.size() - 1);
+
+        return HeapHandle{handle, generations[handle]};
+    }
+
+    // method to check in O(1) if the item with the given handle is in the heap
+    bool contains(HeapHandle handle) const
+    {
+        return handle.index >= 0 && handle.index < static_cast<int>(position.size()) &&
+               generations[handle.index] == handle.generation && position[handle.index] != -1;
+    }
+
+    // method to get the item with the given handle
+    const Item &getItem(HeapHandle handle) const
+    {
+        checkHandle(handle);
+
+        return pq[position[handle.index]];
+    }
+
+    // method to return the item on top of the heap without deleting it
+    const Item &peekTopItem() const
+    {
+        if (pq.empty())
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return pq.front();
+    }
+
+    // method to return the handle of the item on top of the heap
+    HeapHandle peekTopHandle() const
+    {
+        if (pq.empty())
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return HeapHandle{handles.front(), generations[handles.front()]};
+    }
+
+    // method to delete and return the item on top of the heap
+    Item getTopItem()
+    {
+        if (pq.empty())
+            throw runtime_error{"Delete method failed. PQ is empty."};
+
+        // move the top item out before its handle is released
+        Item topItem = move(pq.front());
+
+        removeAt(0);
+
+        return topItem;
+    }
+
+    // method to remove the item with the given handle in O(log n)
+    void remove(HeapHandle handle)
+    {
+        checkHandle(handle);
+
+        removeAt(position[handle.index]);
+    }
+
+    // method to replace the item with the given handle in O(log n)
+    void update(HeapHandle handle, Item newItem)
+    {
+        checkHandle(handle);
+
+        int pos = position[handle.index];
+        pq[pos] = move(newItem);
+
+        restore(pos);
+    }
+
+    // method to print the heap (just for debugging purposes)
+    void printHeap()
+    {
+        for (int i = 0; i < getSize(); i++)
+            cout << pq[i] << "[" << handles[i] << "] ";
+
+        cout << endl;
+    }
+};
+
+// an addressable minimum PQ
+template <typename Item>
+using AddressableMinPQ = AddressableHeap<Item, less<Item>>;
+
+// an addressable maximum PQ
+template <typename Item>
+using AddressableMaxPQ = AddressableHeap<Item, greater<Item>>;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,45 @@
+#include "addressableHeap.hpp"
+
+int main()
+{
+    AddressableMinPQ<int> timers;
+
+    HeapHandle h1 = timers.insert(50);
+    HeapHandle h2 = timers.insert(20);
+    HeapHandle h3 = timers.insert(40);
+    HeapHandle h4 = timers.insert(10);
+
+    timers.printHeap();
+
+    // cancel a timer through its handle
+    timers.remove(h2);
+    timers.printHeap();
+    cout << "Is the timer " << h2.index << " still scheduled? Answer: " << boolalpha << timers.contains(h2) << endl;
+
+    // a new timer reuses the slot of the cancelled one, but the stale handle doesn't refer to it
+    HeapHandle h5 = timers.insert(30);
+    cout << "Does the new timer reuse slot " << h2.index << "? Answer: " << (h5.index == h2.index) << endl;
+    cout << "Is the stale handle valid? Answer: " << timers.contains(h2) << endl;
+
+    try
+    {
+        timers.update(h2, 1);
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << "Update through the stale handle failed: " << e.what() << endl;
+    }
+
+    // postpone a timer through its handle
+    timers.update(h4, 60);
+    timers.printHeap();
+
+    // bring a timer forward through its handle
+    timers.update(h1, 5);
+    cout << "Next timer: " << timers.peekTopItem() << " with handle " << timers.peekTopHandle().index << endl;
+
+    while (!timers.isEmpty())
+        cout << "Fire timer: " << timers.getTopItem() << endl;
+
+    cout << "Is the timer " << h3.index << " still scheduled? Answer: " << boolalpha << timers.contains(h3) << endl;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "heap.hpp"
+#include <string>
+
+// a heavy item type which is expensive to copy
+struct Job
+{
+    int priority;
+    string name;
+
+    Job(int priority, string name) : priority{priority}, name{move(name)} {}
+};
+
+// comparator that puts the job with the highest priority on top
+struct HigherPriority
+{
+    bool operator()(const Job &job1, const Job &job2) const { return job1.priority > job2.priority; }
+};
+
+int main()
+{
+    Heap<Job, HigherPriority> jobs;
+
+    jobs.emplace(3, "compile");
+    jobs.emplace(7, "deploy");
+    jobs.emplace(1, "cleanup");
+    jobs.emplace(5, "test");
+
+    cout << "Number of jobs: " << jobs.getSize() << endl;
+    cout << "Next job: " << jobs.peekTopItem().name << endl;
+
+    while (!jobs.isEmpty())
+        cout << "Run job: " << jobs.getTopItem().name << endl;
+
+    Heap<int, greater<int>> heap{4};
+    for (int i = 0; i < 10; i++)
+        heap.insert(i);
+
+    heap.printHeap();
+}
\ No newline at end of file
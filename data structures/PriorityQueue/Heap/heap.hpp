@@ -0,0 +1,313 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * A generic binary heap parameterized by a comparator. 'compare(a, b)' returns true if the item 'a'
+ * has to be closer to the top of the heap than the item 'b'. So, with 'less<Item>' we get a minimum PQ
+ * and with 'greater<Item>' a maximum PQ (see MinPQ in minimumPQ.hpp and MaxPQ in maximumPQ.hpp).
+ * The items are stored in a growable vector and moved (never copied) while the heap condition is restored.
+*/
+
+template <typename Item, typename Compare = less<Item>>
+class Heap
+{
+    // the heap array
+    vector<Item> pq;
+
+    // the comparator used to order the items; for empty classes like 'less<Item>' the call is inlined
+    Compare compare;
+
+    // method that computes the index of the left child of item at 'idx'
+    int getLeftChildIndex(int idx)
+    {
+        return 2 * idx + 1;
+    }
+
+    // method that computes the index of the parent of item at 'idx'
+    int getParentIndex(int idx)
+    {
+        return (idx - 1) / 2;
+    }
+
+    // method that applies bottom-up heapify to restore the heap condition
+    // instead of swapping at each level, the item is moved out of the heap, its ancestors are moved
+    // down into the hole and the item is moved into its final position at the end
+    void bottomUpHeapify(int curIndex)
+    {
+        // take the item out of the heap
+        Item item = move(pq[curIndex]);
+
+        // move up until current index > 0 AND item has to be on top of the item at parent index
+        while (curIndex > 0)
+        {
+            int parentIndex = getParentIndex(curIndex);
+
+            if (!compare(item, pq[parentIndex]))
+                break;
+
+            // move the parent down into the hole
+            pq[curIndex] = move(pq[parentIndex]);
+
+            // update the current index
+            curIndex = parentIndex;
+        }
+
+        // put the item into the hole
+        pq[curIndex] = move(item);
+    }
+
+    // method that applies top-down heapify to restore the heap condition
+    void topDownHeapify(int curIndex)
+    {
+        int items = pq.size();
+
+        // take the item out of the heap
+        Item item = move(pq[curIndex]);
+
+        while (true)
+        {
+            // get the index of the left child of the element at 'curIndex'
+            int childIndex = getLeftChildIndex(curIndex);
+
+            // check whether or not the loop terminates because there is no child
+            if (childIndex >= items)
+                break;
+
+            // select the right child if it has to be on top of the left child
+            if (childIndex + 1 < items && compare(pq[childIndex + 1], pq[childIndex]))
+                childIndex++;
+
+            // check whether or not the loop terminates because the item is on top of its children
+            if (!compare(pq[childIndex], item))
+                break;
+
+            // move the child up into the hole
+            pq[curIndex] = move(pq[childIndex]);
+
+            // after a move, we have to update the current index
+            curIndex = childIndex;
+        }
+
+        // put the item into the hole
+        pq[curIndex] = move(item);
+    }
+
+    // method that applies Floyd's bottom-up heap construction to all items
+    // every subtree rooted at a non-leaf node is heapified from the last non-leaf node up to the root;
+    // since most nodes are close to the leaves, the total work is O(n) instead of O(n log n)
+    void heapify()
+    {
+        for (int i = static_cast<int>(pq.size()) / 2 - 1; i >= 0; i--)
+            topDownHeapify(i);
+    }
+
+public:
+    // constructor; 'initialCapacity' is only a hint since the heap grows on demand
+    Heap(int initialCapacity = 0, Compare compare = Compare()) : compare{compare}
+    {
+        if (initialCapacity < 0)
+            throw invalid_argument{"Invalid argument: initial capacity < 0."};
+
+        pq.reserve(initialCapacity);
+    }
+
+    // constructor that builds the heap from the items in the range [first, last) in O(n)
+    template <typename Iterator>
+    Heap(int initialCapacity, Iterator first, Iterator last, Compare compare = Compare()) : Heap(initialCapacity, compare)
+    {
+        // copy the items into the heap array in arbitrary order
+        pq.insert(pq.end(), first, last);
+
+        // restore the heap condition for all items at once
+        heapify();
+    }
+
+    // method to get the number of items in the heap
+    int getSize() const
+    {
+        return pq.size();
+    }
+
+    // method to check if the heap is empty
+    bool isEmpty() const
+    {
+        return pq.empty();
+    }
+
+    // method to print the heap (just for debugging purposes)
+    void printHeap()
+    {
+        for (const auto &item : pq)
+            cout << item << " ";
+
+        cout << endl;
+    }
+
+    // method to insert an item into the heap
+    void insert(Item newItem)
+    {
+        // initially, insert the new item at the end of the heap
+        pq.push_back(move(newItem));
+
+        // apply bottom-up heapify to restore the heap condition that might be destroyed after adding the new item
+        bottomUpHeapify(pq.size() - 1);
+    }
+
+    // method to construct an item in place from the given arguments and insert it into the heap
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+        pq.emplace_back(forward<Args>(args)...);
+
+        bottomUpHeapify(pq.size() - 1);
+    }
+
+    // method to insert all items in the range [first, last) into the heap
+    template <typename Iterator>
+    void insertMany(Iterator first, Iterator last)
+    {
+        // holds the number of items to insert
+        int batchSize = distance(first, last);
+
+        // a small batch is cheaper to insert one by one with O(log n) per item
+        if (8 * batchSize < getSize())
+        {
+            for (; first != last; ++first)
+                insert(*first);
+
+            return;
+        }
+
+        // a large batch is appended at the end of the heap and the whole heap is rebuilt in O(n)
+        pq.insert(pq.end(), first, last);
+
+        heapify();
+    }
+
+    // method to merge all items of another heap into this heap; the other heap is empty afterwards
+    // the items are concatenated and the heap is rebuilt in O(n + m), unless the other heap is small
+    void merge(Heap &other)
+    {
+        // merging a heap with itself leaves it unchanged
+        if (this == &other)
+            return;
+
+        if (8 * other.getSize() < getSize())
+        {
+            for (auto &item : other.pq)
+                insert(move(item));
+        }
+        else
+        {
+            pq.insert(pq.end(), make_move_iterator(other.pq.begin()), make_move_iterator(other.pq.end()));
+
+            heapify();
+        }
+
+        other.pq.clear();
+    }
+
+    // method to return the item on top of the heap without deleting it
+    const Item &peekTopItem() const
+    {
+        if (pq.empty())
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return pq.front();
+    }
+
+    // method to delete and return the item on top of the heap
+    Item getTopItem()
+    {
+        if (pq.empty())
+            throw runtime_error{"Delete method failed. PQ is empty."};
+
+        // move the top item out of the heap to return it later
+        Item topItem = move(pq.front());
+
+        // move the last item to the top
+        if (pq.size() > 1)
+        {
+            pq.front() = move(pq.back());
+            pq.pop_back();
+
+            // apply top-down heapify to restore the heap condition
+            topDownHeapify(0);
+        }
+        else
+            pq.pop_back();
+
+        return topItem;
+    }
+
+    // method to replace the item on top of the heap with a new item and restore the heap condition
+    // (cheaper than 'getTopItem' followed by 'insert' since the heap is only traversed once)
+    void replaceTopItem(Item newItem)
+    {
+        if (pq.empty())
+            throw runtime_error{"Replace method failed. PQ is empty."};
+
+        pq.front() = move(newItem);
+
+        topDownHeapify(0);
+    }
+
+    // method to remove an item from the heap
+    // note: the item is found with a linear search; use AddressableHeap for O(log n) removal
+    void remove(const Item &item)
+    {
+        if (pq.empty())
+            throw runtime_error{"Remove method failed. PQ is empty."};
+
+        // apply linear search to find the item
+        for (int i = 0; i < getSize(); i++)
+        {
+            // item found; item to remove is at index i
+            if (item == pq[i])
+            {
+                // item is the last one, so we can just delete it
+                if (i == getSize() - 1)
+                {
+                    pq.pop_back();
+                    return;
+                }
+
+                // move the last item to index i
+                pq[i] = move(pq.back());
+                pq.pop_back();
+
+                // the moved item might be smaller or larger than its new neighbours, so apply
+                // bottom-up heapify and top-down heapify to restore the heap condition
+                if (i > 0 && compare(pq[i], pq[getParentIndex(i)]))
+                    bottomUpHeapify(i);
+                else
+                    topDownHeapify(i);
+
+                return;
+            }
+        }
+    }
+
+    // method to check if a given item is in the heap
+    bool contains(const Item &item) const
+    {
+        // apply linear search to find the item
+        for (const auto &cur : pq)
+            // item found!
+            if (cur == item)
+                return true;
+
+        return false;
+    }
+};
+
+#endif
\ No newline at end of file
@@ -26,4 +26,26 @@ int main()
     minIPQ->change(0, 0.08);
     cout << "Min Key: " << minIPQ->getMinKeyIndex() << endl;
     minIPQ->printTables();
-}
\ No newline at end of file
+    cout << "--------------------------" << endl;
+
+    MinIndexedPQ<double> *bulkIPQ = new MinIndexedPQ<double>(vector<double>{0.43, 0.11, 0.36, 0.25});
+    cout << "Min Key: " << bulkIPQ->getMinKeyIndex() << endl;
+    bulkIPQ->printTables();
+
+    // a batch is checked as a whole: a key index occurring twice rejects it and leaves the heap unchanged
+    MinIndexedPQ<double> *batchIPQ = new MinIndexedPQ<double>(8);
+    batchIPQ->insert(0, 0.5);
+
+    try
+    {
+        batchIPQ->insertMany({{1, 0.4}, {2, 0.3}, {1, 0.2}});
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << "Batch rejected: " << e.what() << endl;
+    }
+
+    batchIPQ->insertMany({{1, 0.4}, {2, 0.3}});
+    cout << "Min Key: " << batchIPQ->getMinKeyIndex() << endl;
+    batchIPQ->printTables();
+}
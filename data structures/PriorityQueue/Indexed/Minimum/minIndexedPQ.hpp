@@ -1,4 +1,6 @@
 #include <vector>
+#include <algorithm>
+#include <utility>
 #include <stdexcept>
 #include <iostream>
 
@@ -149,6 +151,42 @@ class MinIndexedPQ
         indices[pos2] = tmp;
     }
 
+    // method that applies Floyd's bottom-up heap construction to the whole heap in O(n)
+    void heapify()
+    {
+        for (int pos = curSize / 2 - 1; pos >= 0; pos--)
+            topDownHeapify(pos);
+    }
+
+    // method that throws if a key index of the batch is out of range, already in the heap or in the batch twice;
+    // a batch is checked as a whole before any key index is inserted, so an invalid batch leaves the heap unchanged
+    void checkBatch(const vector<pair<int, T>> &batch) const
+    {
+        vector<int> keyIndices;
+        keyIndices.reserve(batch.size());
+
+        for (const auto &[keyIndex, value] : batch)
+        {
+            if (keyIndex < 0 || keyIndex >= maxSize || position[keyIndex] != -1)
+                throw invalid_argument{"Invalid argument: key index out of range or already exists."};
+
+            keyIndices.push_back(keyIndex);
+        }
+
+        sort(keyIndices.begin(), keyIndices.end());
+        if (adjacent_find(keyIndices.begin(), keyIndices.end()) != keyIndices.end())
+            throw invalid_argument{"Invalid argument: key index occurs twice in the batch."};
+    }
+
+    // method that appends a key index at the end of the heap without restoring the heap condition
+    void append(int keyIndex, T value)
+    {
+        position[keyIndex] = curSize;
+        indices[curSize] = keyIndex;
+        priorities[keyIndex] = value;
+        curSize++;
+    }
+
 public:
     MinIndexedPQ(int maxSize) : maxSize{maxSize}, curSize{0}
     {
@@ -162,6 +200,17 @@ public:
         priorities.assign(maxSize, -1);
     }
 
+    // constructor that builds the heap from all key indices 0..n-1 at once in O(n), where
+    // key index i gets the priority 'initialPriorities[i]'
+    // (e.g. all vertices of a graph with an initial distance of infinity)
+    MinIndexedPQ(const vector<T> &initialPriorities) : MinIndexedPQ(initialPriorities.size())
+    {
+        for (int ki = 0; ki < maxSize; ki++)
+            append(ki, initialPriorities[ki]);
+
+        heapify();
+    }
+
     // method that performs insertion of a key index
     void insert(int keyIndex, T value)
     {
@@ -181,6 +230,27 @@ public:
         curSize++;
     }
 
+    // method that performs insertion of a batch of (key index, priority) pairs
+    void insertMany(const vector<pair<int, T>> &batch)
+    {
+        checkBatch(batch);
+
+        // a small batch is cheaper to insert one by one with O(log n) per key index
+        if (8 * static_cast<int>(batch.size()) < curSize)
+        {
+            for (const auto &[keyIndex, value] : batch)
+                insert(keyIndex, value);
+
+            return;
+        }
+
+        // a large batch is appended at the end of the heap and the whole heap is rebuilt in O(n)
+        for (const auto &[keyIndex, value] : batch)
+            append(keyIndex, value);
+
+        heapify();
+    }
+
     // method that applies removal of a key index
     void remove(int keyIndex)
     {
@@ -0,0 +1,34 @@
+#include "minMaxHeap.hpp"
+
+int main()
+{
+    MinMaxHeap<int> heap;
+
+    for (int item : {40, 10, 70, 20, 90, 50, 30, 80, 60})
+        heap.insert(item);
+
+    heap.printHeap();
+    cout << "Min item: " << heap.peekMinimumItem() << ", max item: " << heap.peekMaximumItem() << endl;
+
+    cout << "Delete min item: " << heap.getMinimumItem() << endl;
+    cout << "Delete max item: " << heap.getMaximumItem() << endl;
+    heap.printHeap();
+
+    // a bounded buffer of 4 items which always evicts the oldest (smallest) timestamp
+    MinMaxHeap<int> buffer{4};
+
+    for (int timestamp : {5, 3, 8, 1, 9, 2, 7})
+    {
+        auto evicted = buffer.insertEvictMinimum(timestamp);
+
+        cout << "Insert " << timestamp;
+        if (evicted)
+            cout << ", evicted " << *evicted;
+        cout << endl;
+    }
+
+    cout << "Buffer: ";
+    while (!buffer.isEmpty())
+        cout << buffer.getMaximumItem() << " ";
+    cout << endl;
+}
\ No newline at end of file
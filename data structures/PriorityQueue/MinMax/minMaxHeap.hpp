@@ -0,0 +1,310 @@
+#ifndef MIN_MAX_HEAP_HPP
+#define MIN_MAX_HEAP_HPP
+
+#include <vector>
+#include <functional>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * A double-ended priority queue implemented as a min-max heap in a single array.
+ * The levels of the binary tree alternate between min levels (even depth, starting with the root) and max levels
+ * (odd depth). An item on a min level is smaller than or equal to all items in its subtree and an item on a max
+ * level is larger than or equal to all items in its subtree. So, the minimum item is the root and the maximum item
+ * is one of the root's children, both found in O(1); insertion and deletion of the minimum or maximum item run in
+ * O(log n).
+ * The heap can be bounded by a maximum size. In that case 'insertEvictMinimum' and 'insertEvictMaximum' insert an
+ * item into a full heap by evicting the item at one end.
+*/
+
+template <typename Item, typename Compare = less<Item>>
+class MinMaxHeap
+{
+    // the heap array
+    vector<Item> pq;
+
+    // holds the maximum size of the heap (0 if the heap is unbounded)
+    int maxSize;
+
+    // the comparator; 'compare(a, b)' returns true if 'a' is smaller than 'b'
+    Compare compare;
+
+    // method that computes the index of the parent of item at 'idx'
+    int getParentIndex(int idx)
+    {
+        return (idx - 1) / 2;
+    }
+
+    // method that computes the index of the left child of item at 'idx'
+    int getLeftChildIndex(int idx)
+    {
+        return 2 * idx + 1;
+    }
+
+    // method to check if the item at 'idx' is on a min level
+    bool isOnMinLevel(int idx)
+    {
+        // the depth of 'idx' is floor(log2(idx + 1))
+        int depth = 0;
+        for (unsigned int i = idx + 1; i > 1; i >>= 1)
+            depth++;
+
+        return depth % 2 == 0;
+    }
+
+    // method that checks if the item at idx1 has to be closer to the root than the item at idx2 on a min level
+    // (isMin = true) or on a max level (isMin = false)
+    bool before(int idx1, int idx2, bool isMin)
+    {
+        return isMin ? compare(pq[idx1], pq[idx2]) : compare(pq[idx2], pq[idx1]);
+    }
+
+    // method that moves the item at 'curIndex' up along the levels of the same kind (min or max)
+    void bottomUpHeapify(int curIndex, bool isMin)
+    {
+        // the grandparent is on a level of the same kind
+        while (curIndex > 2)
+        {
+            int grandparentIndex = getParentIndex(getParentIndex(curIndex));
+
+            if (!before(curIndex, grandparentIndex, isMin))
+                break;
+
+            swap(pq[curIndex], pq[grandparentIndex]);
+            curIndex = grandparentIndex;
+        }
+    }
+
+    // method that restores the heap condition after adding an item at 'curIndex'
+    void pushUp(int curIndex)
+    {
+        if (curIndex == 0)
+            return;
+
+        bool isMin = isOnMinLevel(curIndex);
+        int parentIndex = getParentIndex(curIndex);
+
+        // the item belongs to the levels of the other kind, e.g. an item on a min level which is larger than its
+        // parent on a max level: swap it with the parent and move it up along the levels of the parent's kind
+        if (before(parentIndex, curIndex, isMin))
+        {
+            swap(pq[curIndex], pq[parentIndex]);
+            bottomUpHeapify(parentIndex, !isMin);
+        }
+        else
+            bottomUpHeapify(curIndex, isMin);
+    }
+
+    // method that restores the heap condition after replacing the item at 'curIndex'
+    // the item moves down along the levels of the same kind and is exchanged with a parent of the other kind
+    // if necessary
+    void topDownHeapify(int curIndex)
+    {
+        bool isMin = isOnMinLevel(curIndex);
+        int items = pq.size();
+
+        while (true)
+        {
+            int firstChild = getLeftChildIndex(curIndex);
+
+            if (firstChild >= items)
+                break;
+
+            // find the smallest (min level) or largest (max level) of the children and grandchildren
+            int bestIndex = firstChild;
+
+            if (firstChild + 1 < items && before(firstChild + 1, bestIndex, isMin))
+                bestIndex = firstChild + 1;
+
+            int firstGrandchild = getLeftChildIndex(firstChild);
+            for (int i = firstGrandchild; i < firstGrandchild + 4 && i < items; i++)
+                if (before(i, bestIndex, isMin))
+                    bestIndex = i;
+
+            if (!before(bestIndex, curIndex, isMin))
+                break;
+
+            swap(pq[bestIndex], pq[curIndex]);
+
+            // the best item was a child: the children have no children of their own
+            // which are on a level of the same kind, so we are done
+            if (bestIndex <= firstChild + 1)
+                break;
+
+            // the best item was a grandchild: the moved item might belong to the level of its new parent
+            int parentIndex = getParentIndex(bestIndex);
+            if (before(parentIndex, bestIndex, isMin))
+                swap(pq[parentIndex], pq[bestIndex]);
+
+            curIndex = bestIndex;
+        }
+    }
+
+    // method that returns the index of the maximum item
+    int getMaximumIndex() const
+    {
+        if (pq.size() == 1)
+            return 0;
+
+        if (pq.size() == 2)
+            return 1;
+
+        return compare(pq[1], pq[2]) ? 2 : 1;
+    }
+
+    // method to delete and return the item at 'idx' (the minimum or the maximum item)
+    Item removeAt(int idx)
+    {
+        Item removedItem = move(pq[idx]);
+
+        if (idx != static_cast<int>(pq.size()) - 1)
+        {
+            pq[idx] = move(pq.back());
+            pq.pop_back();
+            topDownHeapify(idx);
+        }
+        else
+            pq.pop_back();
+
+        return removedItem;
+    }
+
+public:
+    // constructor; a maximum size of 0 means that the heap is unbounded
+    MinMaxHeap(int maxSize = 0, Compare compare = Compare()) : maxSize{maxSize}, compare{compare}
+    {
+        if (maxSize < 0)
+            throw invalid_argument{"Invalid argument: max size < 0."};
+
+        pq.reserve(maxSize);
+    }
+
+    // method to get the number of items in the heap
+    int getSize() const
+    {
+        return pq.size();
+    }
+
+    // method to check if the heap is empty
+    bool isEmpty() const
+    {
+        return pq.empty();
+    }
+
+    // method to check if a bounded heap is full
+    bool isFull() const
+    {
+        return maxSize > 0 && getSize() == maxSize;
+    }
+
+    // method to print the heap (just for debugging purposes)
+    void printHeap()
+    {
+        for (const auto &item : pq)
+            cout << item << " ";
+
+        cout << endl;
+    }
+
+    // method to insert an item into the heap
+    void insert(Item newItem)
+    {
+        if (isFull())
+            throw runtime_error{"Insert method failed. PQ is full."};
+
+        pq.push_back(move(newItem));
+        pushUp(pq.size() - 1);
+    }
+
+    // method to return the minimum item without deleting it
+    const Item &peekMinimumItem() const
+    {
+        if (pq.empty())
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return pq[0];
+    }
+
+    // method to return the maximum item without deleting it
+    const Item &peekMaximumItem() const
+    {
+        if (pq.empty())
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return pq[getMaximumIndex()];
+    }
+
+    // method to delete and return the minimum item
+    Item getMinimumItem()
+    {
+        if (pq.empty())
+            throw runtime_error{"Delete method failed. PQ is empty."};
+
+        return removeAt(0);
+    }
+
+    // method to delete and return the maximum item
+    Item getMaximumItem()
+    {
+        if (pq.empty())
+            throw runtime_error{"Delete method failed. PQ is empty."};
+
+        return removeAt(getMaximumIndex());
+    }
+
+    // method to insert an item; if the heap is full, the minimum item is evicted and returned
+    // (if the new item is not larger than the minimum item, the new item itself is returned)
+    optional<Item> insertEvictMinimum(Item newItem)
+    {
+        if (!isFull())
+        {
+            insert(move(newItem));
+            return nullopt;
+        }
+
+        if (!compare(pq[0], newItem))
+            return newItem;
+
+        // replace the minimum item with the new item
+        Item evictedItem = move(pq[0]);
+        pq[0] = move(newItem);
+        topDownHeapify(0);
+
+        return evictedItem;
+    }
+
+    // method to insert an item; if the heap is full, the maximum item is evicted and returned
+    // (if the new item is not smaller than the maximum item, the new item itself is returned)
+    optional<Item> insertEvictMaximum(Item newItem)
+    {
+        if (!isFull())
+        {
+            insert(move(newItem));
+            return nullopt;
+        }
+
+        int maxIndex = getMaximumIndex();
+
+        if (!compare(newItem, pq[maxIndex]))
+            return newItem;
+
+        // replace the maximum item with the new item
+        Item evictedItem = move(pq[maxIndex]);
+        pq[maxIndex] = move(newItem);
+
+        // the new item might be smaller than the minimum item at the root
+        if (maxIndex > 0 && compare(pq[maxIndex], pq[0]))
+            swap(pq[maxIndex], pq[0]);
+
+        if (maxIndex > 0)
+            topDownHeapify(maxIndex);
+
+        return evictedItem;
+    }
+};
+
+#endif
\ No newline at end of file
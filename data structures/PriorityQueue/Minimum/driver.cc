@@ -1,4 +1,5 @@
 #include "minimumPQ.hpp"
+#include <vector>
 
 int main()
 {
@@ -21,4 +22,14 @@ int main()
 
     int itemToSearch = 4;
     cout << "Is the item " << itemToSearch << " in the heap? Answer: " << boolalpha << mPQ->contains(itemToSearch) << endl;
+
+    vector<int> initialItems{9, 3, 7, 1, 8, 2};
+    MinPQ<int> *bulkPQ = new MinPQ<int>(10, initialItems.begin(), initialItems.end());
+    bulkPQ->printHeap();
+
+    vector<int> batch{6, 0, 4};
+    bulkPQ->insertMany(batch.begin(), batch.end());
+    bulkPQ->printHeap();
+
+    cout << "Min item: " << bulkPQ->getMinimumItem() << endl;
 }
\ No newline at end of file
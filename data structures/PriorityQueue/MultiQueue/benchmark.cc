@@ -0,0 +1,82 @@
+/**
+ * A benchmark that compares the throughput of the MultiQueue with a MinPQ protected by a global mutex.
+ * Every thread alternately inserts a random item and deletes an item. The number of threads goes from 1 to 64.
+*/
+
+#include "multiQueue.hpp"
+#include <chrono>
+#include <vector>
+
+// a MinPQ protected by a global mutex
+struct LockedMinPQ
+{
+    mutex lock;
+    MinPQ<int> pq;
+
+    void insert(int item)
+    {
+        lock_guard<mutex> guard{lock};
+        pq.insert(item);
+    }
+
+    bool tryDeleteMin(int &item)
+    {
+        lock_guard<mutex> guard{lock};
+        if (pq.isEmpty())
+            return false;
+
+        item = pq.getMinimumItem();
+        return true;
+    }
+};
+
+// runs 'opsPerThread' insert/delete pairs on 'threads' threads and returns the million operations per second
+template <typename PQ>
+double run(PQ &pq, int threads, int opsPerThread)
+{
+    // prefill the queue so that deletions find items
+    for (int i = 0; i < 1000000; i++)
+        pq.insert(i * 7919LL % 1000003);
+
+    auto start = chrono::steady_clock::now();
+
+    vector<thread> workers;
+    for (int t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&pq, t, opsPerThread]() {
+            unsigned int state = t + 1;
+            int item;
+
+            for (int i = 0; i < opsPerThread; i++)
+            {
+                state = state * 1103515245 + 12345;
+                pq.insert(state % 1000003);
+                pq.tryDeleteMin(item);
+            }
+        });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    return 2.0 * threads * opsPerThread / elapsed.count() / 1e6;
+}
+
+int main()
+{
+    const int opsPerThread = 200000;
+
+    cout << "threads\tlocked MinPQ (Mops/s)\tMultiQueue (Mops/s)" << endl;
+
+    for (int threads = 1; threads <= 64; threads *= 2)
+    {
+        LockedMinPQ locked;
+        MultiQueue<int> mq{threads};
+
+        double lockedThroughput = run(locked, threads, opsPerThread);
+        double mqThroughput = run(mq, threads, opsPerThread);
+
+        cout << threads << "\t" << lockedThroughput << "\t\t\t" << mqThroughput << endl;
+    }
+}
\ No newline at end of file
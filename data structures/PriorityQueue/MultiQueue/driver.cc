@@ -0,0 +1,43 @@
+#include "multiQueue.hpp"
+#include <set>
+#include <random>
+
+int main()
+{
+    // a MultiQueue for 4 threads, i.e. 8 shards
+    MultiQueue<int> mq{4};
+    cout << "Number of shards: " << mq.getNrOfShards() << endl;
+
+    mt19937 gen{42};
+    multiset<int> sorted;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        int item = gen() % 1000000;
+        mq.insert(item);
+        sorted.insert(item);
+    }
+
+    // measure the rank error, i.e. how many smaller items are still in the queue when an item is deleted
+    long totalRank = 0;
+    long maxRank = 0;
+    int item;
+
+    while (mq.tryDeleteMin(item))
+    {
+        auto iter = sorted.find(item);
+        long rank = distance(sorted.begin(), iter);
+        sorted.erase(iter);
+
+        totalRank += rank;
+        maxRank = max(maxRank, rank);
+
+        // only the first deletions are measured since 'distance' is linear
+        if (sorted.size() == 90000)
+            break;
+    }
+
+    cout << "Average rank error: " << static_cast<double>(totalRank) / 10000 << endl;
+    cout << "Maximum rank error: " << maxRank << endl;
+    cout << "Items left: " << mq.getSize() << endl;
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#ifndef MULTI_QUEUE_HPP
+#define MULTI_QUEUE_HPP
+
+#include "../Minimum/minimumPQ.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * A concurrent relaxed minimum priority queue (MultiQueue).
+ * The MultiQueue consists of c * T independent MinPQ shards (T = number of threads, c = a small constant),
+ * each protected by its own lock. Threads never wait for a lock: they only use 'try_lock' and pick another
+ * shard if the lock is taken.
+ * - 'insert' puts the item into a randomly chosen shard.
+ * - 'tryDeleteMin' picks two random shards, compares their minimum items and deletes the smaller one.
+ * The deleted item is not necessarily the global minimum. Since every item ends up in a uniformly chosen
+ * shard and the better of two random shards is taken, the expected rank of a deleted item (its position in
+ * the sorted order of all items) is O(c * T) and does not grow with the number of items in the queue;
+ * large rank errors are exponentially unlikely. With one shard the MultiQueue is an exact MinPQ.
+*/
+
+template <typename Item>
+class MultiQueue
+{
+    // a shard: a MinPQ with its own lock, aligned to a cache line to avoid false sharing
+    struct alignas(64) Shard
+    {
+        mutex lock;
+        MinPQ<Item> pq;
+    };
+
+    // holds the number of shards
+    int nrOfShards;
+
+    // the shards
+    unique_ptr<Shard[]> shards;
+
+    // holds the (approximate) number of items in the queue
+    atomic<long> items{0};
+
+    // method that returns a random shard index; every thread has its own random number generator
+    int randomShard()
+    {
+        // xorshift random number generator seeded with the thread id
+        static thread_local unsigned long long state = hash<thread::id>{}(this_thread::get_id()) | 1;
+
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        return state % nrOfShards;
+    }
+
+    // method that deletes the minimum item of a locked shard
+    Item deleteFrom(Shard &shard)
+    {
+        Item minItem = shard.pq.getMinimumItem();
+        items.fetch_sub(1, memory_order_relaxed);
+        return minItem;
+    }
+
+public:
+    // constructor; creates 'c * threads' shards
+    MultiQueue(int threads, int c = 2) : nrOfShards{threads * c}
+    {
+        // Sanity checks
+        if (threads <= 0 || c <= 0)
+            throw invalid_argument{"Invalid argument: threads <= 0 OR c <= 0."};
+
+        shards = make_unique<Shard[]>(nrOfShards);
+    }
+
+    // method to get the number of shards
+    int getNrOfShards() const
+    {
+        return nrOfShards;
+    }
+
+    // method to get the number of items; only approximate while other threads modify the queue
+    long getSize() const
+    {
+        return items.load(memory_order_relaxed);
+    }
+
+    // method to check if the queue is (approximately) empty
+    bool isEmpty() const
+    {
+        return getSize() <= 0;
+    }
+
+    // method to insert an item into a random shard
+    void insert(Item newItem)
+    {
+        while (true)
+        {
+            Shard &shard = shards[randomShard()];
+
+            // the shard is used by another thread, so try another one
+            if (!shard.lock.try_lock())
+                continue;
+
+            shard.pq.insert(move(newItem));
+            items.fetch_add(1, memory_order_relaxed);
+            shard.lock.unlock();
+
+            return;
+        }
+    }
+
+    // method to delete an item close to the minimum; returns false if the queue is empty
+    bool tryDeleteMin(Item &minItem)
+    {
+        // holds the number of attempts in which both sampled shards were empty
+        int emptyAttempts = 0;
+
+        while (true)
+        {
+            // the queue looks empty, so check the item counter before giving up
+            if (emptyAttempts >= nrOfShards)
+            {
+                emptyAttempts = 0;
+
+                if (isEmpty())
+                    return false;
+            }
+
+            // sample two shards
+            int i = randomShard();
+            int j = randomShard();
+
+            // with only one shard (or a collision) we just use the one sampled shard
+            if (i == j)
+            {
+                Shard &shard = shards[i];
+
+                if (!shard.lock.try_lock())
+                    continue;
+
+                bool empty = shard.pq.isEmpty();
+                if (!empty)
+                    minItem = deleteFrom(shard);
+
+                shard.lock.unlock();
+
+                if (!empty)
+                    return true;
+
+                emptyAttempts++;
+                continue;
+            }
+
+            Shard &first = shards[i];
+            Shard &second = shards[j];
+
+            // a thread never waits for a lock, so we can't run into a deadlock here
+            if (!first.lock.try_lock())
+                continue;
+
+            if (!second.lock.try_lock())
+            {
+                first.lock.unlock();
+                continue;
+            }
+
+            // select the shard with the smaller minimum item
+            Shard *better = nullptr;
+            if (first.pq.isEmpty())
+                better = second.pq.isEmpty() ? nullptr : &second;
+            else if (second.pq.isEmpty())
+                better = &first;
+            else
+                better = second.pq.peekTopItem() < first.pq.peekTopItem() ? &second : &first;
+
+            if (better != nullptr)
+                minItem = deleteFrom(*better);
+
+            second.lock.unlock();
+            first.lock.unlock();
+
+            if (better != nullptr)
+                return true;
+
+            emptyAttempts++;
+        }
+    }
+};
+
+#endif
\ No newline at end of file
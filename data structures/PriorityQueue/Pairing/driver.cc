@@ -0,0 +1,48 @@
+#include "pairingHeap.hpp"
+#include "../Minimum/minimumPQ.hpp"
+#include <chrono>
+
+int main()
+{
+    // two workers build their local heaps
+    MinPairingHeap<int> worker1;
+    MinPairingHeap<int> worker2;
+
+    for (int item : {42, 7, 19, 3})
+        worker1.insert(item);
+
+    for (int item : {11, 5, 27})
+        worker2.insert(item);
+
+    // combine them in O(1)
+    worker1.merge(worker2);
+    cout << "Items after merge: " << worker1.getSize() << ", items left in worker 2: " << worker2.getSize() << endl;
+
+    cout << "Items in order: ";
+    while (!worker1.isEmpty())
+        cout << worker1.getTopItem() << " ";
+    cout << endl;
+
+    // combine shards of the array-based MinPQ
+    const int shards = 8;
+    const int itemsPerShard = 1000000;
+
+    vector<MinPQ<int>> local(shards);
+    for (int s = 0; s < shards; s++)
+        for (int i = 0; i < itemsPerShard; i++)
+            local[s].insert((i * 7919LL + s) % 1000003);
+
+    auto start = chrono::steady_clock::now();
+
+    MinPQ<int> combined;
+    for (auto &shard : local)
+        combined.merge(shard);
+
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    cout << "Merged " << combined.getSize() << " items of " << shards << " MinPQ shards in " << elapsed.count() << " s" << endl;
+    cout << "Min item: " << combined.getMinimumItem() << endl;
+
+    // merging a heap with itself leaves it unchanged
+    combined.merge(combined);
+    cout << "Items after merging with itself: " << combined.getSize() << endl;
+}
\ No newline at end of file
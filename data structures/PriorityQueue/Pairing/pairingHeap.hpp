@@ -0,0 +1,237 @@
+#ifndef PAIRING_HEAP_HPP
+#define PAIRING_HEAP_HPP
+
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/**
+ * A pairing heap parameterized by a comparator (see Heap in heap.hpp for the meaning of 'compare').
+ * A pairing heap is a heap-ordered multiway tree. Every node points to its first child and to its next sibling.
+ * - 'insert' and 'merge' (meld) just link two trees: the root which has to be on top becomes the parent of the
+ *   other root. Both run in O(1).
+ * - 'getTopItem' deletes the root and combines its children with the two-pass pairing: first the children are
+ *   linked in pairs from left to right, then the pairs are linked from right to left. It runs in amortized O(log n).
+ * So, merging two heaps of sharded workers is O(1) instead of draining one heap into the other.
+*/
+
+template <typename Item, typename Compare = less<Item>>
+class PairingHeap
+{
+    // a node of the heap-ordered tree
+    struct Node
+    {
+        Item item;
+        Node *child;
+        Node *sibling;
+    };
+
+    // points to the root of the tree
+    Node *root;
+
+    // holds the number of items
+    int items;
+
+    // the comparator used to order the items
+    Compare compare;
+
+    // method that links two trees and returns the root of the resulting tree
+    Node *link(Node *first, Node *second)
+    {
+        if (first == nullptr)
+            return second;
+
+        if (second == nullptr)
+            return first;
+
+        // 'first' becomes the root
+        if (compare(second->item, first->item))
+            swap(first, second);
+
+        // 'second' becomes the first child of 'first'
+        second->sibling = first->child;
+        first->child = second;
+
+        return first;
+    }
+
+    // method that combines a list of siblings into one tree with the two-pass pairing
+    Node *mergePairs(Node *first)
+    {
+        // first pass: link the siblings in pairs from left to right; the linked pairs are collected
+        // in reverse order through their sibling pointers
+        Node *pairs = nullptr;
+
+        while (first != nullptr)
+        {
+            Node *a = first;
+            Node *b = a->sibling;
+
+            if (b == nullptr)
+            {
+                a->sibling = pairs;
+                pairs = a;
+                break;
+            }
+
+            first = b->sibling;
+            a->sibling = nullptr;
+            b->sibling = nullptr;
+
+            Node *linked = link(a, b);
+            linked->sibling = pairs;
+            pairs = linked;
+        }
+
+        // second pass: link the pairs from right to left
+        Node *result = nullptr;
+
+        while (pairs != nullptr)
+        {
+            Node *next = pairs->sibling;
+            pairs->sibling = nullptr;
+            result = link(result, pairs);
+            pairs = next;
+        }
+
+        return result;
+    }
+
+    // method that deletes all nodes (iteratively, since the tree might be very deep)
+    void clear()
+    {
+        vector<Node *> stack;
+        if (root != nullptr)
+            stack.push_back(root);
+
+        while (!stack.empty())
+        {
+            Node *node = stack.back();
+            stack.pop_back();
+
+            if (node->child != nullptr)
+                stack.push_back(node->child);
+
+            if (node->sibling != nullptr)
+                stack.push_back(node->sibling);
+
+            delete node;
+        }
+
+        root = nullptr;
+        items = 0;
+    }
+
+public:
+    // constructor
+    PairingHeap(Compare compare = Compare()) : root{nullptr}, items{0}, compare{compare} {}
+
+    // the nodes are owned by the heap, so it can only be moved
+    PairingHeap(const PairingHeap &) = delete;
+    PairingHeap &operator=(const PairingHeap &) = delete;
+
+    PairingHeap(PairingHeap &&other) : root{other.root}, items{other.items}, compare{other.compare}
+    {
+        other.root = nullptr;
+        other.items = 0;
+    }
+
+    PairingHeap &operator=(PairingHeap &&other)
+    {
+        if (this != &other)
+        {
+            clear();
+            swap(root, other.root);
+            swap(items, other.items);
+            compare = other.compare;
+        }
+
+        return *this;
+    }
+
+    // destructor
+    ~PairingHeap()
+    {
+        clear();
+    }
+
+    // method to get the number of items in the heap
+    int getSize() const
+    {
+        return items;
+    }
+
+    // method to check if the heap is empty
+    bool isEmpty() const
+    {
+        return items == 0;
+    }
+
+    // method to insert an item into the heap in O(1)
+    void insert(Item newItem)
+    {
+        root = link(root, new Node{move(newItem), nullptr, nullptr});
+        items++;
+    }
+
+    // method to construct an item in place and insert it into the heap in O(1)
+    template <typename... Args>
+    void emplace(Args &&...args)
+    {
+        insert(Item(forward<Args>(args)...));
+    }
+
+    // method to return the item on top of the heap without deleting it
+    const Item &peekTopItem() const
+    {
+        if (root == nullptr)
+            throw runtime_error{"Peek method failed. PQ is empty."};
+
+        return root->item;
+    }
+
+    // method to delete and return the item on top of the heap in amortized O(log n)
+    Item getTopItem()
+    {
+        if (root == nullptr)
+            throw runtime_error{"Delete method failed. PQ is empty."};
+
+        Node *oldRoot = root;
+        Item topItem = move(oldRoot->item);
+
+        // the children of the old root form the new tree
+        root = mergePairs(oldRoot->child);
+        items--;
+
+        delete oldRoot;
+
+        return topItem;
+    }
+
+    // method to merge (meld) all items of another heap into this heap in O(1); the other heap is empty afterwards
+    void merge(PairingHeap &other)
+    {
+        if (this == &other)
+            return;
+
+        root = link(root, other.root);
+        items += other.items;
+
+        other.root = nullptr;
+        other.items = 0;
+    }
+};
+
+// a minimum pairing heap
+template <typename Item>
+using MinPairingHeap = PairingHeap<Item, less<Item>>;
+
+// a maximum pairing heap
+template <typename Item>
+using MaxPairingHeap = PairingHeap<Item, greater<Item>>;
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+/**
+ * A benchmark that compares the TimerWheel with an addressable MinPQ used as a deadline queue when most timers
+ * are cancelled before they fire. The timers get random deadlines and are then advanced to the last deadline.
+ * Note: a plain MinPQ can only cancel with a linear search, so the addressable MinPQ is used for the comparison.
+*/
+
+#include "timerWheel.hpp"
+#include "../Addressable/addressableHeap.hpp"
+#include <chrono>
+#include <random>
+
+int main()
+{
+    const int n = 2000000;
+    const unsigned long long maxDelay = 1000000;
+
+    mt19937 gen{42};
+    vector<unsigned long long> deadlines(n);
+    for (auto &deadline : deadlines)
+        deadline = 1 + gen() % maxDelay;
+
+    cout << "cancel rate\tMinPQ (s)\tTimerWheel (s)" << endl;
+
+    for (int cancelPercent : {0, 50, 90, 99})
+    {
+        vector<bool> cancelled(n);
+        for (int i = 0; i < n; i++)
+            cancelled[i] = static_cast<int>(gen() % 100) < cancelPercent;
+
+        // deadline queue based on the addressable MinPQ
+        auto start = chrono::steady_clock::now();
+        {
+            AddressableMinPQ<pair<unsigned long long, int>> pq;
+            vector<HeapHandle> handles(n);
+
+            for (int i = 0; i < n; i++)
+                handles[i] = pq.insert({deadlines[i], i});
+
+            for (int i = 0; i < n; i++)
+                if (cancelled[i])
+                    pq.remove(handles[i]);
+
+            long fired = 0;
+            while (!pq.isEmpty())
+                fired += pq.getTopItem().second >= 0;
+        }
+        chrono::duration<double> pqTime = chrono::steady_clock::now() - start;
+
+        // deadline queue based on the timer wheel
+        start = chrono::steady_clock::now();
+        {
+            TimerWheel<int> wheel;
+            vector<TimerHandle> handles(n);
+
+            for (int i = 0; i < n; i++)
+                handles[i] = wheel.insert(deadlines[i], i);
+
+            for (int i = 0; i < n; i++)
+                if (cancelled[i])
+                    wheel.cancel(handles[i]);
+
+            long fired = 0;
+            for (unsigned long long time = 1; time <= maxDelay; time++)
+            {
+                wheel.advance(time);
+                while (wheel.hasExpiredItem())
+                    fired += wheel.getMinimumItem() >= 0;
+            }
+        }
+        chrono::duration<double> wheelTime = chrono::steady_clock::now() - start;
+
+        cout << cancelPercent << "%\t\t" << pqTime.count() << "\t\t" << wheelTime.count() << endl;
+    }
+}
\ No newline at end of file
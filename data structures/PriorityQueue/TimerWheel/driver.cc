@@ -0,0 +1,32 @@
+#include "timerWheel.hpp"
+#include <string>
+
+int main()
+{
+    TimerWheel<string> wheel;
+
+    wheel.insert(10, "connection 1 timeout");
+    TimerHandle handle = wheel.insert(20, "connection 2 timeout");
+    wheel.insert(300, "connection 3 timeout");
+    wheel.insert(70000, "connection 4 timeout");
+
+    cout << "Number of timers: " << wheel.getSize() << endl;
+
+    // connection 2 was closed in time
+    cout << "Cancel connection 2 timeout? Answer: " << boolalpha << wheel.cancel(handle) << endl;
+    cout << "Cancel connection 2 timeout again? Answer: " << boolalpha << wheel.cancel(handle) << endl;
+
+    for (unsigned long long time : {15, 299, 300, 100000})
+    {
+        wheel.advance(time);
+        cout << "Time " << wheel.getCurrentTime() << ":" << endl;
+
+        while (wheel.hasExpiredItem())
+        {
+            auto deadline = wheel.getMinimumDeadline();
+            cout << "  fired " << wheel.getMinimumItem() << " (deadline " << deadline << ")" << endl;
+        }
+    }
+
+    cout << "Is the wheel empty? Answer: " << wheel.isEmpty() << endl;
+}
\ No newline at end of file
@@ -0,0 +1,326 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <vector>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+using namespace std;
+
+/**
+ * A hierarchical timing wheel used to schedule items that expire at a given deadline (in ticks).
+ * The wheel consists of 4 levels with 256 slots each. Level 0 has a resolution of 1 tick, level 1 of 256 ticks,
+ * level 2 of 256^2 ticks and so on; deadlines which are more than 2^32 ticks away are kept in an overflow list.
+ * A timer is put into the lowest level whose range contains its deadline. When the current time enters the range
+ * of a slot of a higher level, the timers of that slot are moved (cascaded) to the lower levels; every timer is
+ * cascaded at most 4 times, so advancing the time costs amortized O(1) per tick and per timer.
+ * The timers are stored in a pool and linked into the slots with intrusive doubly linked lists, so 'insert' and
+ * 'cancel' are O(1). Cancelled timers cost nothing afterwards, which makes the wheel much cheaper than a MinPQ
+ * when most timers are cancelled before they fire.
+ * The draining interface is similar to MinPQ: after 'advance', 'getMinimumItem' deletes and returns the expired
+ * items in the order of their deadlines (an item inserted with a deadline that already passed expires immediately
+ * and is queued behind the items which expired before).
+*/
+
+// a handle used to cancel a timer; a handle becomes invalid after its timer fired or was cancelled
+struct TimerHandle
+{
+    int index;
+    unsigned int generation;
+};
+
+template <typename Item>
+class TimerWheel
+{
+    // holds the number of levels
+    static const int levels = 4;
+
+    // holds the number of bits of the deadline used by each level
+    static const int slotBits = 8;
+
+    // holds the number of slots per level
+    static const int slotsPerLevel = 1 << slotBits;
+
+    // the id of the list holding the timers that are too far in the future
+    static const int overflowList = levels * slotsPerLevel;
+
+    // the id of the list holding the expired timers in the order of their deadlines
+    static const int expiredList = overflowList + 1;
+
+    // a timer in the pool
+    struct Timer
+    {
+        unsigned long long deadline;
+        Item item;
+
+        // previous and next timer in the same list (-1 if none)
+        int prev;
+        int next;
+
+        // id of the list containing the timer (-1 if the timer is unused)
+        int list;
+
+        // incremented every time the timer is released, so old handles become invalid
+        unsigned int generation;
+    };
+
+    // a doubly linked list of timers
+    struct List
+    {
+        int head = -1;
+        int tail = -1;
+    };
+
+    // the pool of timers
+    vector<Timer> timers;
+
+    // indices of unused timers in the pool
+    vector<int> freeTimers;
+
+    // the slots of all levels, the overflow list and the expired list
+    vector<List> lists;
+
+    // holds the current time
+    unsigned long long now;
+
+    // holds the number of timers which are scheduled but not expired yet
+    int scheduled;
+
+    // holds the number of expired timers which are not drained yet
+    int expired;
+
+    // method to append a timer to a list
+    void link(int idx, int list)
+    {
+        Timer &timer = timers[idx];
+        List &l = lists[list];
+
+        timer.list = list;
+        timer.prev = l.tail;
+        timer.next = -1;
+
+        if (l.tail != -1)
+            timers[l.tail].next = idx;
+        else
+            l.head = idx;
+
+        l.tail = idx;
+    }
+
+    // method to remove a timer from its list
+    void unlink(int idx)
+    {
+        Timer &timer = timers[idx];
+        List &l = lists[timer.list];
+
+        if (timer.prev != -1)
+            timers[timer.prev].next = timer.next;
+        else
+            l.head = timer.next;
+
+        if (timer.next != -1)
+            timers[timer.next].prev = timer.prev;
+        else
+            l.tail = timer.prev;
+
+        timer.list = -1;
+    }
+
+    // method to release a timer back to the pool
+    void release(int idx)
+    {
+        timers[idx].generation++;
+        freeTimers.push_back(idx);
+    }
+
+    // method that puts a scheduled timer into the list matching its deadline
+    void place(int idx)
+    {
+        unsigned long long deadline = timers[idx].deadline;
+
+        // the timer is due
+        if (deadline <= now)
+        {
+            link(idx, expiredList);
+            scheduled--;
+            expired++;
+            return;
+        }
+
+        // find the lowest level whose range around the current time contains the deadline
+        for (int level = 0; level < levels; level++)
+        {
+            int shift = slotBits * (level + 1);
+
+            if ((deadline >> shift) == (now >> shift))
+            {
+                int slot = (deadline >> (slotBits * level)) & (slotsPerLevel - 1);
+                link(idx, level * slotsPerLevel + slot);
+                return;
+            }
+        }
+
+        link(idx, overflowList);
+    }
+
+    // method that moves all timers of a list to the lists matching their deadlines
+    void cascade(int list)
+    {
+        int idx = lists[list].head;
+        lists[list] = List{};
+
+        while (idx != -1)
+        {
+            int next = timers[idx].next;
+            place(idx);
+            idx = next;
+        }
+    }
+
+    // method that advances the current time by one tick
+    void tick()
+    {
+        now++;
+
+        // find the highest level whose slot changed, i.e. all bits of the lower levels are zero
+        int level = 0;
+        while (level < levels && ((now >> (slotBits * (level + 1))) << (slotBits * (level + 1))) == now)
+            level++;
+
+        // all levels wrapped around: the overflow timers might be in range now
+        if (level == levels)
+            cascade(overflowList);
+
+        // cascade the current slots from the highest to the lowest level
+        for (int l = min(level, levels - 1); l >= 1; l--)
+        {
+            int slot = (now >> (slotBits * l)) & (slotsPerLevel - 1);
+            cascade(l * slotsPerLevel + slot);
+        }
+
+        // all timers in the current slot of level 0 are due
+        cascade(now & (slotsPerLevel - 1));
+    }
+
+    // method that checks whether a handle refers to a scheduled or expired timer
+    bool isValid(TimerHandle handle) const
+    {
+        return handle.index >= 0 && handle.index < static_cast<int>(timers.size()) &&
+               timers[handle.index].generation == handle.generation && timers[handle.index].list != -1;
+    }
+
+public:
+    // constructor
+    TimerWheel(unsigned long long startTime = 0) : now{startTime}, scheduled{0}, expired{0}
+    {
+        lists.assign(expiredList + 1, List{});
+    }
+
+    // method to get the current time
+    unsigned long long getCurrentTime() const
+    {
+        return now;
+    }
+
+    // method to get the number of timers which are scheduled or expired but not drained yet
+    int getSize() const
+    {
+        return scheduled + expired;
+    }
+
+    // method to check if there are no timers at all
+    bool isEmpty() const
+    {
+        return getSize() == 0;
+    }
+
+    // method to check if there are expired items which can be drained with 'getMinimumItem'
+    bool hasExpiredItem() const
+    {
+        return expired > 0;
+    }
+
+    // method to schedule an item which expires at 'deadline'; returns a handle to cancel the timer
+    TimerHandle insert(unsigned long long deadline, Item item)
+    {
+        int idx;
+
+        // reuse an unused timer or create a new one
+        if (!freeTimers.empty())
+        {
+            idx = freeTimers.back();
+            freeTimers.pop_back();
+            timers[idx].item = move(item);
+        }
+        else
+        {
+            idx = timers.size();
+            timers.push_back(Timer{0, move(item), -1, -1, -1, 0});
+        }
+
+        timers[idx].deadline = deadline;
+        scheduled++;
+        place(idx);
+
+        return TimerHandle{idx, timers[idx].generation};
+    }
+
+    // method to cancel a timer in O(1); returns false if the timer already fired or was cancelled
+    bool cancel(TimerHandle handle)
+    {
+        if (!isValid(handle))
+            return false;
+
+        if (timers[handle.index].list == expiredList)
+            expired--;
+        else
+            scheduled--;
+
+        unlink(handle.index);
+        release(handle.index);
+
+        return true;
+    }
+
+    // method to advance the current time; timers with a deadline <= 'newTime' expire
+    void advance(unsigned long long newTime)
+    {
+        while (now < newTime)
+        {
+            // nothing is scheduled, so we can jump to the new time
+            if (scheduled == 0)
+            {
+                now = newTime;
+                return;
+            }
+
+            tick();
+        }
+    }
+
+    // method to delete and return the next expired item
+    Item getMinimumItem()
+    {
+        if (!hasExpiredItem())
+            throw runtime_error{"No expired item."};
+
+        int idx = lists[expiredList].head;
+        unlink(idx);
+        release(idx);
+        expired--;
+
+        return move(timers[idx].item);
+    }
+
+    // method to get the deadline of the next expired item
+    unsigned long long getMinimumDeadline() const
+    {
+        if (!hasExpiredItem())
+            throw runtime_error{"No expired item."};
+
+        return timers[lists[expiredList].head].deadline;
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "topK.hpp"
+#include <chrono>
+#include <random>
+
+int main()
+{
+    // keep the 5 largest items
+    TopK<int> largest{5};
+    int stream[] = {12, 3, 45, 7, 89, 23, 56, 1, 90, 34, 67, 8};
+    largest.offer(stream, sizeof(stream) / sizeof(stream[0]));
+
+    cout << "5 largest items: ";
+    for (auto item : largest.getItems())
+        cout << item << " ";
+    cout << endl;
+
+    // keep the 3 smallest items
+    TopK<int, greater<int>> smallest{3};
+    smallest.offer(begin(stream), end(stream));
+
+    cout << "3 smallest items: ";
+    for (auto item : smallest.getItems())
+        cout << item << " ";
+    cout << endl;
+
+    // a long stream of random items
+    const size_t n = 20000000;
+    vector<unsigned int> items(n);
+    mt19937 gen{42};
+    for (auto &item : items)
+        item = gen();
+
+    for (int k : {10, 64, 1000})
+    {
+        auto start = chrono::steady_clock::now();
+
+        TopK<unsigned int> topK{k};
+        topK.offer(items.data(), n);
+
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        cout << "k = " << k << ": best item " << topK.getItems().front() << " in " << elapsed.count() << " s" << endl;
+
+        start = chrono::steady_clock::now();
+
+        auto result = parallelTopK(items.data(), n, k, 4);
+
+        elapsed = chrono::steady_clock::now() - start;
+        cout << "k = " << k << " (4 threads): best item " << result.front() << " in " << elapsed.count() << " s" << endl;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#ifndef TOP_K_HPP
+#define TOP_K_HPP
+
+#include "../Heap/heap.hpp"
+#include <algorithm>
+#include <thread>
+
+/**
+ * A streaming top-k accumulator that keeps the k best items offered to it.
+ * An item 'a' is worse than an item 'b' if 'compare(a, b)' returns true; so with 'less<Item>' the k largest
+ * items are kept and with 'greater<Item>' the k smallest items.
+ * Every candidate is first compared with the worst item kept so far (the threshold) and rejected right away
+ * if it is not better; in a long stream most candidates are rejected with this single comparison.
+ * - For k <= 64 the items are kept in a small sorted array. The position of an accepted item is computed by
+ *   counting the worse items without branches, which the compiler can vectorize for arithmetic items.
+ * - For larger k the items are kept in a heap whose top is the worst item, which is replaced in O(log k).
+*/
+
+template <typename Item, typename Compare = less<Item>>
+class TopK
+{
+    // the largest k that uses the sorted array instead of the heap
+    static const int smallK = 64;
+
+    // holds the number of items to keep
+    int k;
+
+    // the comparator; 'compare(a, b)' is true if 'a' is worse than 'b'
+    Compare compare;
+
+    // the items for k <= 64, sorted from the worst to the best item
+    vector<Item> sorted;
+
+    // the items for k > 64; the top of the heap is the worst item
+    Heap<Item, Compare> heap;
+
+    // method to check if the small sorted array is used
+    bool isSmall() const
+    {
+        return k <= smallK;
+    }
+
+    // method that counts the items in the sorted array which are worse than the given item
+    int countWorse(const Item &item) const
+    {
+        int count = 0;
+        int items = sorted.size();
+
+        // no early exit: every item is compared and the results are summed up
+        for (int i = 0; i < items; i++)
+            count += compare(sorted[i], item);
+
+        return count;
+    }
+
+public:
+    // constructor
+    TopK(int k, Compare compare = Compare()) : k{k}, compare{compare}, heap{0, compare}
+    {
+        // Sanity checks
+        if (k <= 0)
+            throw invalid_argument{"Invalid argument: k <= 0."};
+
+        if (isSmall())
+            sorted.reserve(k);
+    }
+
+    // method to get the number of items kept so far (at most k)
+    int getSize() const
+    {
+        return isSmall() ? sorted.size() : heap.getSize();
+    }
+
+    // method to check if k items are kept
+    bool isFull() const
+    {
+        return getSize() == k;
+    }
+
+    // method to get the worst item kept so far; a candidate has to be better to be accepted
+    const Item &getThreshold() const
+    {
+        if (getSize() == 0)
+            throw runtime_error{"No threshold: no items kept."};
+
+        return isSmall() ? sorted.front() : heap.peekTopItem();
+    }
+
+    // method to offer a candidate; returns true if the candidate is kept
+    bool offer(const Item &item)
+    {
+        // fast reject: the candidate is not better than the worst item kept
+        if (isFull() && !compare(getThreshold(), item))
+            return false;
+
+        if (!isSmall())
+        {
+            if (isFull())
+                heap.replaceTopItem(item);
+            else
+                heap.insert(item);
+
+            return true;
+        }
+
+        int pos = countWorse(item);
+
+        if (!isFull())
+        {
+            sorted.insert(sorted.begin() + pos, item);
+            return true;
+        }
+
+        // the worst item at index 0 is dropped: shift the worse items one to the left
+        // and put the candidate into the freed position
+        for (int i = 0; i < pos - 1; i++)
+            sorted[i] = move(sorted[i + 1]);
+
+        sorted[pos - 1] = item;
+
+        return true;
+    }
+
+    // method to offer all candidates in the range [first, last)
+    template <typename Iterator>
+    void offer(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first)
+            offer(*first);
+    }
+
+    // method to offer an array of candidates
+    void offer(const Item *items, size_t n)
+    {
+        offer(items, items + n);
+    }
+
+    // method to merge the items kept by another accumulator into this one
+    void merge(const TopK &other)
+    {
+        if (other.isSmall())
+            offer(other.sorted.begin(), other.sorted.end());
+        else
+        {
+            for (const auto &item : other.getItems())
+                offer(item);
+        }
+    }
+
+    // method to get the items kept, sorted from the best to the worst item
+    vector<Item> getItems() const
+    {
+        vector<Item> result;
+
+        if (isSmall())
+            result.assign(sorted.rbegin(), sorted.rend());
+        else
+        {
+            // drain a copy of the heap; the worst items come first
+            Heap<Item, Compare> copy = heap;
+            while (!copy.isEmpty())
+                result.push_back(copy.getTopItem());
+
+            reverse(result.begin(), result.end());
+        }
+
+        return result;
+    }
+};
+
+// function that computes the k best items of an array in parallel: every thread computes the top-k of one
+// part of the array and the partial results are merged at the end
+template <typename Item, typename Compare = less<Item>>
+vector<Item> parallelTopK(const Item *items, size_t n, int k, int threads, Compare compare = Compare())
+{
+    // Sanity checks
+    if (threads <= 0)
+        throw invalid_argument{"Invalid argument: threads <= 0."};
+
+    vector<TopK<Item, Compare>> partial(threads, TopK<Item, Compare>{k, compare});
+    vector<thread> workers;
+
+    // holds the number of items per thread
+    size_t chunk = (n + threads - 1) / threads;
+
+    for (int t = 0; t < threads; t++)
+    {
+        size_t begin = min(n, t * chunk);
+        size_t end = min(n, begin + chunk);
+
+        workers.emplace_back([&partial, items, t, begin, end]() { partial[t].offer(items + begin, end - begin); });
+    }
+
+    for (auto &worker : workers)
+        worker.join();
+
+    // merge the partial results into the first one
+    for (int t = 1; t < threads; t++)
+        partial[0].merge(partial[t]);
+
+    return partial[0].getItems();
+}
+
+#endif
\ No newline at end of file